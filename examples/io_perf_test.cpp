@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright Contributors to the OpenTimelineIO project
 
+#include <filesystem>
 #include <iostream>
 
 #include "opentimelineio/clip.h"
@@ -22,8 +23,13 @@ const struct {
     bool TO_JSON_STRING_NO_DOWNGRADE = true;
     bool TO_JSON_FILE                = true;
     bool TO_JSON_FILE_NO_DOWNGRADE   = true;
+    bool TO_JSON_FILE_THROUGHPUT     = true;
     bool CLONE_TEST                  = true;
+    bool TIMELINE_CLONE_TEST         = true;
+    bool CONTENT_HASH_TEST           = true;
     bool SINGLE_CLIP_DOWNGRADE_TEST  = true;
+    bool TRAVERSAL_TEST              = true;
+    bool INTERNED_LOAD_TEST          = true;
 } RUN_STRUCT ;
 
 // typedef std::chrono::duration<float> fsec;
@@ -154,6 +160,87 @@ main(
     }
 
     print_elapsed_time("deserialize_json_from_file", begin, end);
+    std::cout << "  peak memory after deserialize: ";
+    std::cout << examples::peak_rss() / (1024 * 1024) << " [MB]" << std::endl;
+
+    if (RUN_STRUCT.TRAVERSAL_TEST)
+    {
+        // find_clips copies a Retainer for every object it visits, so this
+        // mostly measures reference counting
+        const int iterations = 10;
+        size_t    clip_count = 0;
+        begin = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++)
+        {
+            clip_count += timeline.value->find_clips(&err).size();
+        }
+        end = std::chrono::steady_clock::now();
+        assert(!otio::is_error(err));
+        std::cout << "  clips per traversal: " << clip_count / iterations;
+        std::cout << std::endl;
+        print_elapsed_time("find_clips x10", begin, end);
+    }
+
+    if (RUN_STRUCT.INTERNED_LOAD_TEST)
+    {
+        otio::ReadOptions options;
+        options.intern_strings = true;
+
+        begin = std::chrono::steady_clock::now();
+        otio::SerializableObject::Retainer<> interned_timeline(
+            otio::SerializableObject::from_json_file(
+                examples::normalize_path(argv[1]),
+                &err,
+                options));
+        end = std::chrono::steady_clock::now();
+        assert(!otio::is_error(err));
+        assert(interned_timeline.value != nullptr);
+        print_elapsed_time("from_json_file [interned]", begin, end);
+
+        auto stats = otio::InternedString::pool_stats();
+        std::cout << "interned strings: " << stats.strings << " values, "
+                  << stats.references << " references, " << stats.bytes
+                  << " bytes stored, " << stats.bytes_saved()
+                  << " bytes saved" << std::endl;
+
+        begin = std::chrono::steady_clock::now();
+        interned_timeline = nullptr;
+        end = std::chrono::steady_clock::now();
+        print_elapsed_time("release [interned]", begin, end);
+    }
+
+    if (RUN_STRUCT.TIMELINE_CLONE_TEST)
+    {
+        begin = std::chrono::steady_clock::now();
+        otio::SerializableObject::Retainer<> cloned(
+            timeline.value->clone(&err)
+        );
+        end = std::chrono::steady_clock::now();
+        assert(!otio::is_error(err));
+        assert(cloned.value != nullptr);
+        print_elapsed_time("clone timeline", begin, end);
+
+        begin = std::chrono::steady_clock::now();
+        const bool equivalent = timeline.value->is_equivalent_to(*cloned);
+        end = std::chrono::steady_clock::now();
+        assert(equivalent);
+        print_elapsed_time("is_equivalent_to clone", begin, end);
+    }
+
+    if (RUN_STRUCT.CONTENT_HASH_TEST)
+    {
+        // the second call finds the digest cached by the first
+        for (const std::string label :
+             { "content_hash", "content_hash [cached]" })
+        {
+            begin = std::chrono::steady_clock::now();
+            const auto hash = timeline.value->content_hash(&err);
+            end = std::chrono::steady_clock::now();
+            assert(!otio::is_error(err));
+            print_elapsed_time(label, begin, end);
+            std::cout << "  " << hash.to_string() << std::endl;
+        }
+    }
 
 
     double str_dg, str_nodg;
@@ -240,6 +327,33 @@ main(
         std::cout << std::endl;
     }
 
+    if (RUN_STRUCT.TO_JSON_FILE_THROUGHPUT)
+    {
+        for (const int indent : { 4, 0 })
+        {
+            const std::string out_path = examples::normalize_path(
+                tmp_dir_path + "/io_perf_test.indent"
+                + std::to_string(indent) + ".otio"
+            );
+            begin = std::chrono::steady_clock::now();
+            timeline.value->to_json_file(out_path, &err, {}, indent);
+            end = std::chrono::steady_clock::now();
+            assert(!otio::is_error(err));
+
+            const double seconds = print_elapsed_time(
+                    "serialize_json_to_file [indent "
+                    + std::to_string(indent) + "]",
+                    begin,
+                    end
+            );
+            const double megabytes = (
+                std::filesystem::file_size(out_path) / (1024.0 * 1024.0)
+            );
+            std::cout << "  " << megabytes << " [MB] at ";
+            std::cout << megabytes / seconds << " [MB/s]" << std::endl;
+        }
+    }
+
     if (keep_tmp || RUN_STRUCT.FIXED_TMP)
     {
         std::cout << "Temp directory preserved.  All files written to: ";
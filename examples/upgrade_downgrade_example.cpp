@@ -67,7 +67,9 @@ main(
         2,
         [](otio::AnyDictionary* d)
         {
-            (*d)["new_field"] = (*d)["my_field"];
+            // copy the value out first: adding a key may move the others
+            auto value = (*d)["my_field"];
+            (*d)["new_field"] = value;
             d->erase("my_field");
         }
     );
@@ -77,7 +79,9 @@ main(
         2,
         [](otio::AnyDictionary* d)
         {
-            (*d)["my_field"] = (*d)["new_field"];
+            // copy the value out first: adding a key may move the others
+            auto value = (*d)["new_field"];
+            (*d)["my_field"] = value;
             d->erase("new_field");
         }
     );
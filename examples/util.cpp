@@ -17,10 +17,12 @@
 #endif // WIN32_LEAN_AND_MEAN
 #include <windows.h>
 #include <combaseapi.h>
+#include <psapi.h>
 #if defined(min)
 #undef min
 #endif // min
 #else // _WINDOWS
+#include <sys/resource.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <dirent.h>
@@ -122,6 +124,16 @@ std::vector<std::string> glob(std::string const& path, std::string const& patter
     return out;
 }
 
+size_t peak_rss()
+{
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    {
+        return 0;
+    }
+    return counters.PeakWorkingSetSize;
+}
+
 #else // _WINDOWS
 
 std::string normalize_path(std::string const& in)
@@ -186,6 +198,21 @@ std::vector<std::string> glob(std::string const& path, std::string const& patter
     return out;
 }
 
+size_t peak_rss()
+{
+    struct rusage usage;
+    if (0 != getrusage(RUSAGE_SELF, &usage))
+    {
+        return 0;
+    }
+#if defined(__APPLE__)
+    return usage.ru_maxrss;
+#else
+    // Linux reports kilobytes
+    return usage.ru_maxrss * 1024;
+#endif
+}
+
 #endif // _WINDOWS
 
 void print_error(otio::ErrorStatus const& error_status)
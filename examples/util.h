@@ -5,6 +5,7 @@
 
 #include <opentimelineio/errorStatus.h>
 
+#include <cstddef>
 #include <vector>
 
 namespace examples {
@@ -21,6 +22,10 @@ std::string create_temp_dir();
 // Get a list of files from a directory.
 std::vector<std::string> glob(std::string const& path, std::string const& pattern);
 
+// Get the peak resident memory of the process in bytes, or zero if it is
+// not known.
+size_t peak_rss();
+
 // Print an error to std::cerr.
 void print_error(opentimelineio::OPENTIMELINEIO_VERSION::ErrorStatus const&);
 
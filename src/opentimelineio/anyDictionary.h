@@ -10,8 +10,502 @@
 #include <map>
 #include <string>
 
+#ifdef OTIO_FLAT_ANY_DICTIONARY
+#    include "opentimelineio/internedString.h"
+
+#    include <algorithm>
+#    include <cstddef>
+#    include <functional>
+#    include <initializer_list>
+#    include <iterator>
+#    include <stdexcept>
+#    include <type_traits>
+#    include <utility>
+#    include <vector>
+#endif
+
 namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
 
+#ifdef OTIO_FLAT_ANY_DICTIONARY
+/**
+ * The storage of an AnyDictionary when OTIO_FLAT_ANY_DICTIONARY is defined:
+ * the API of std::map<std::string, std::any>, with the entries kept in one
+ * vector sorted by key rather than in a tree node each.  Most dictionaries
+ * hold a handful of entries, so this saves both memory and allocations.
+ *
+ * As with a std::vector, adding or removing an entry (including operator[]
+ * of a new key) invalidates iterators and references to the entries.  Code
+ * such as
+ *     (*d)["new_key"] = (*d)["old_key"];
+ * must therefore copy the value out first.
+ *
+ * The entries are stored with keys that are not const, so that they can be
+ * moved as the vector grows or shifts, and iterators hand out a pair of
+ * references to the key and the value rather than a value_type&.  Members
+ * and structured bindings work as usual, but a loop over the entries must
+ * take them as auto const& or auto&&, not auto&.
+ *
+ * Keys are held as InternedStrings.  Those of entries added while the
+ * decoder is interning strings (see ReadOptions::intern_strings) refer to
+ * the pool, so every dictionary of a document shares one copy of a key such
+ * as "cmx_3600"; copying a dictionary shares its keys with the copy.
+ */
+class AnyDictionaryFlatMap
+{
+    // An entry as stored.
+    using _Entry = std::pair<InternedString, std::any>;
+
+    // An iterator over the entries, or over constant entries if Const.
+    template <bool Const>
+    class _Iterator
+    {
+        using _EntryPointer = std::conditional_t<Const, _Entry const*, _Entry*>;
+        using _Mapped = std::conditional_t<Const, std::any const, std::any>;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = std::pair<const std::string, std::any>;
+        using difference_type   = std::ptrdiff_t;
+        using reference         = std::pair<std::string const&, _Mapped&>;
+
+        // What operator->() returns: the entry's reference pair, kept alive
+        // for the rest of the expression.
+        class pointer
+        {
+        public:
+            reference* operator->() noexcept { return &_reference; }
+
+        private:
+            explicit pointer(reference reference)
+                : _reference(reference)
+            {}
+
+            reference _reference;
+
+            friend class _Iterator;
+        };
+
+        _Iterator() = default;
+
+        // an iterator converts to a const_iterator
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        _Iterator(_Iterator<false> other) noexcept
+            : _entry(other._entry)
+        {}
+
+        reference operator*() const noexcept
+        {
+            return reference(_entry->first.str(), _entry->second);
+        }
+
+        pointer operator->() const noexcept { return pointer(**this); }
+
+        reference operator[](difference_type n) const noexcept
+        {
+            return *(*this + n);
+        }
+
+        _Iterator& operator++() noexcept
+        {
+            ++_entry;
+            return *this;
+        }
+
+        _Iterator operator++(int) noexcept { return _Iterator(_entry++); }
+
+        _Iterator& operator--() noexcept
+        {
+            --_entry;
+            return *this;
+        }
+
+        _Iterator operator--(int) noexcept { return _Iterator(_entry--); }
+
+        _Iterator& operator+=(difference_type n) noexcept
+        {
+            _entry += n;
+            return *this;
+        }
+
+        _Iterator& operator-=(difference_type n) noexcept
+        {
+            _entry -= n;
+            return *this;
+        }
+
+        friend _Iterator operator+(_Iterator it, difference_type n) noexcept
+        {
+            return it += n;
+        }
+
+        friend _Iterator operator+(difference_type n, _Iterator it) noexcept
+        {
+            return it += n;
+        }
+
+        friend _Iterator operator-(_Iterator it, difference_type n) noexcept
+        {
+            return it -= n;
+        }
+
+        friend difference_type
+        operator-(_Iterator const& lhs, _Iterator const& rhs) noexcept
+        {
+            return lhs._entry - rhs._entry;
+        }
+
+        friend bool
+        operator==(_Iterator const& lhs, _Iterator const& rhs) noexcept
+        {
+            return lhs._entry == rhs._entry;
+        }
+
+        friend bool
+        operator!=(_Iterator const& lhs, _Iterator const& rhs) noexcept
+        {
+            return lhs._entry != rhs._entry;
+        }
+
+        friend bool
+        operator<(_Iterator const& lhs, _Iterator const& rhs) noexcept
+        {
+            return lhs._entry < rhs._entry;
+        }
+
+        friend bool
+        operator>(_Iterator const& lhs, _Iterator const& rhs) noexcept
+        {
+            return lhs._entry > rhs._entry;
+        }
+
+        friend bool
+        operator<=(_Iterator const& lhs, _Iterator const& rhs) noexcept
+        {
+            return lhs._entry <= rhs._entry;
+        }
+
+        friend bool
+        operator>=(_Iterator const& lhs, _Iterator const& rhs) noexcept
+        {
+            return lhs._entry >= rhs._entry;
+        }
+
+    private:
+        explicit _Iterator(_EntryPointer entry) noexcept
+            : _entry(entry)
+        {}
+
+        _EntryPointer _entry = nullptr;
+
+        friend class AnyDictionaryFlatMap;
+        friend class _Iterator<!Const>;
+    };
+
+public:
+    using key_type               = std::string;
+    using mapped_type            = std::any;
+    using value_type             = std::pair<const std::string, std::any>;
+    using size_type              = std::size_t;
+    using difference_type        = std::ptrdiff_t;
+    using key_compare            = std::less<std::string>;
+    using allocator_type         = std::allocator<value_type>;
+    using iterator               = _Iterator<false>;
+    using const_iterator         = _Iterator<true>;
+    using reference              = iterator::reference;
+    using const_reference        = const_iterator::reference;
+    using pointer                = iterator::pointer;
+    using const_pointer          = const_iterator::pointer;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    class value_compare
+    {
+    public:
+        bool
+        operator()(value_type const& lhs, value_type const& rhs) const
+        {
+            return lhs.first < rhs.first;
+        }
+    };
+
+    AnyDictionaryFlatMap() = default;
+
+    AnyDictionaryFlatMap(std::initializer_list<value_type> ilist)
+    {
+        insert(ilist);
+    }
+
+    template <typename InputIt>
+    AnyDictionaryFlatMap(InputIt first, InputIt last)
+    {
+        insert(first, last);
+    }
+
+    AnyDictionaryFlatMap& operator=(std::initializer_list<value_type> ilist)
+    {
+        _entries.clear();
+        insert(ilist);
+        return *this;
+    }
+
+    allocator_type get_allocator() const noexcept { return allocator_type(); }
+
+    std::any& at(const key_type& key)
+    {
+        auto it = find(key);
+        if (it == end())
+        {
+            throw std::out_of_range("AnyDictionaryFlatMap::at");
+        }
+        return it->second;
+    }
+
+    std::any const& at(const key_type& key) const
+    {
+        auto it = find(key);
+        if (it == end())
+        {
+            throw std::out_of_range("AnyDictionaryFlatMap::at");
+        }
+        return it->second;
+    }
+
+    std::any& operator[](const key_type& key)
+    {
+        auto pos = _lower_bound(key);
+        if (pos == _entries.end() || pos->first.str() != key)
+        {
+            pos = _entries.emplace(pos, key, std::any());
+            _store_key(pos->first);
+        }
+        return pos->second;
+    }
+
+    std::any& operator[](key_type&& key)
+    {
+        auto pos = _lower_bound(key);
+        if (pos == _entries.end() || pos->first.str() != key)
+        {
+            pos = _entries.emplace(pos, std::move(key), std::any());
+            _store_key(pos->first);
+        }
+        return pos->second;
+    }
+
+    iterator       begin() noexcept { return iterator(_entries.data()); }
+    const_iterator begin() const noexcept
+    {
+        return const_iterator(_entries.data());
+    }
+    const_iterator cbegin() const noexcept { return begin(); }
+    iterator       end() noexcept { return begin() + _entries.size(); }
+    const_iterator end() const noexcept { return begin() + _entries.size(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    reverse_iterator       rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+    const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+    const_reverse_iterator crend() const noexcept { return rend(); }
+
+    void clear() noexcept
+    {
+        _entries.clear();
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        return _insert(_Entry(std::forward<Args>(args)...));
+    }
+
+    template <typename... Args>
+    iterator emplace_hint(const_iterator, Args&&... args)
+    {
+        return emplace(std::forward<Args>(args)...).first;
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        return _insert(_Entry(value.first, value.second));
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value)
+    {
+        return _insert(_Entry(value.first, std::move(value.second)));
+    }
+
+    template <
+        typename P,
+        typename = std::enable_if_t<std::is_constructible<_Entry, P&&>::value>>
+    std::pair<iterator, bool> insert(P&& value)
+    {
+        return _insert(_Entry(std::forward<P>(value)));
+    }
+
+    iterator insert(const_iterator, const value_type& value)
+    {
+        return insert(value).first;
+    }
+
+    iterator insert(const_iterator, value_type&& value)
+    {
+        return insert(std::move(value)).first;
+    }
+
+    template <
+        typename P,
+        typename = std::enable_if_t<std::is_constructible<_Entry, P&&>::value>>
+    iterator insert(const_iterator, P&& value)
+    {
+        return insert(std::forward<P>(value)).first;
+    }
+
+    template <typename InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+        {
+            emplace(*first);
+        }
+    }
+
+    void insert(std::initializer_list<value_type> ilist)
+    {
+        insert(ilist.begin(), ilist.end());
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        auto i = _entries.erase(_entries.begin() + (pos - begin()));
+        return begin() + (i - _entries.begin());
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        auto i = _entries.erase(
+            _entries.begin() + (first - begin()),
+            _entries.begin() + (last - begin()));
+        return begin() + (i - _entries.begin());
+    }
+
+    size_type erase(const key_type& key)
+    {
+        auto it = find(key);
+        if (it == end())
+        {
+            return 0;
+        }
+        erase(it);
+        return 1;
+    }
+
+    void swap(AnyDictionaryFlatMap& other) { _entries.swap(other._entries); }
+
+    bool      empty() const noexcept { return _entries.empty(); }
+    size_type max_size() const noexcept { return _entries.max_size(); }
+    size_type size() const noexcept { return _entries.size(); }
+
+    size_type count(const key_type& key) const
+    {
+        return find(key) != end() ? 1 : 0;
+    }
+
+    std::pair<iterator, iterator> equal_range(const key_type& key)
+    {
+        auto first = lower_bound(key);
+        return { first, first + count(key) };
+    }
+
+    std::pair<const_iterator, const_iterator>
+    equal_range(const key_type& key) const
+    {
+        auto first = lower_bound(key);
+        return { first, first + count(key) };
+    }
+
+    iterator find(const key_type& key)
+    {
+        auto it = lower_bound(key);
+        return (it != end() && it->first == key) ? it : end();
+    }
+
+    const_iterator find(const key_type& key) const
+    {
+        auto it = lower_bound(key);
+        return (it != end() && it->first == key) ? it : end();
+    }
+
+    iterator lower_bound(const key_type& key)
+    {
+        return begin() + (_lower_bound(key) - _entries.begin());
+    }
+
+    const_iterator lower_bound(const key_type& key) const
+    {
+        return const_cast<AnyDictionaryFlatMap*>(this)->lower_bound(key);
+    }
+
+    iterator upper_bound(const key_type& key)
+    {
+        auto it = lower_bound(key);
+        return (it != end() && it->first == key) ? it + 1 : it;
+    }
+
+    const_iterator upper_bound(const key_type& key) const
+    {
+        return const_cast<AnyDictionaryFlatMap*>(this)->upper_bound(key);
+    }
+
+    key_compare   key_comp() const { return key_compare(); }
+    value_compare value_comp() const { return value_compare(); }
+
+private:
+    std::vector<_Entry>::iterator _lower_bound(const key_type& key)
+    {
+        return std::lower_bound(
+            _entries.begin(),
+            _entries.end(),
+            key,
+            [](_Entry const& entry, const key_type& key) {
+                return entry.first.str() < key;
+            });
+    }
+
+    std::pair<iterator, bool> _insert(_Entry&& entry)
+    {
+        auto pos = _lower_bound(entry.first.str());
+        if (pos != _entries.end() && pos->first.str() == entry.first.str())
+        {
+            return { begin() + (pos - _entries.begin()), false };
+        }
+        _store_key(entry.first);
+        pos = _entries.insert(pos, std::move(entry));
+        return { begin() + (pos - _entries.begin()), true };
+    }
+
+    // Interns the key of a new entry if strings read on this thread are
+    // interned (see InternedString::decoded).
+    static void _store_key(InternedString& key)
+    {
+        if (InternedString::interning() && !key.is_interned()
+            && !key.str().empty())
+        {
+            key = InternedString::intern(key.str());
+        }
+    }
+
+    std::vector<_Entry> _entries;
+};
+#endif
+
 /**
  * An AnyDictionary has exactly the same API as
  *    std::map<std::string, std::any>
@@ -25,10 +519,21 @@ namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
  * This allows us to hand out iterators that can be aware of mutation and moves
  * and take steps to safe-guard themselves from causing a crash.  (Yes,
  * I'm talking to you, Python...)
+ *
+ * If OTIO_FLAT_ANY_DICTIONARY is defined, the entries are stored in an
+ * AnyDictionaryFlatMap, and adding an entry bumps the stamp as well.
  */
-class AnyDictionary : private std::map<std::string, std::any>
+class AnyDictionary
+#ifdef OTIO_FLAT_ANY_DICTIONARY
+    : private AnyDictionaryFlatMap
+#else
+    : private std::map<std::string, std::any>
+#endif
 {
 public:
+#ifdef OTIO_FLAT_ANY_DICTIONARY
+    using map = AnyDictionaryFlatMap;
+#endif
     using map::map;
 
     AnyDictionary()
@@ -77,7 +582,9 @@ public:
     using map::get_allocator;
 
     using map::at;
+#ifndef OTIO_FLAT_ANY_DICTIONARY
     using map::operator[];
+#endif
 
     using map::begin;
     using map::cbegin;
@@ -93,9 +600,98 @@ public:
         mutate();
         map::clear();
     }
+#ifdef OTIO_FLAT_ANY_DICTIONARY
+    // adding an entry moves the others, so it counts as a mutation
+
+    mapped_type& operator[](const key_type& key)
+    {
+        const size_type old_size = size();
+        mapped_type&    value    = map::operator[](key);
+        added(old_size);
+        return value;
+    }
+
+    mapped_type& operator[](key_type&& key)
+    {
+        const size_type old_size = size();
+        mapped_type&    value    = map::operator[](std::move(key));
+        added(old_size);
+        return value;
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        const size_type old_size = size();
+        auto            result   = map::emplace(std::forward<Args>(args)...);
+        added(old_size);
+        return result;
+    }
+
+    template <typename... Args>
+    iterator emplace_hint(const_iterator hint, Args&&... args)
+    {
+        const size_type old_size = size();
+        auto result = map::emplace_hint(hint, std::forward<Args>(args)...);
+        added(old_size);
+        return result;
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        return emplace(value);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value)
+    {
+        return emplace(std::move(value));
+    }
+
+    template <
+        typename P,
+        typename =
+            std::enable_if_t<std::is_constructible<value_type, P&&>::value>>
+    std::pair<iterator, bool> insert(P&& value)
+    {
+        return emplace(std::forward<P>(value));
+    }
+
+    iterator insert(const_iterator hint, const value_type& value)
+    {
+        return emplace_hint(hint, value);
+    }
+
+    iterator insert(const_iterator hint, value_type&& value)
+    {
+        return emplace_hint(hint, std::move(value));
+    }
+
+    template <
+        typename P,
+        typename =
+            std::enable_if_t<std::is_constructible<value_type, P&&>::value>>
+    iterator insert(const_iterator hint, P&& value)
+    {
+        return emplace_hint(hint, std::forward<P>(value));
+    }
+
+    template <typename InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        const size_type old_size = size();
+        map::insert(first, last);
+        added(old_size);
+    }
+
+    void insert(std::initializer_list<value_type> ilist)
+    {
+        insert(ilist.begin(), ilist.end());
+    }
+#else
     using map::emplace;
     using map::emplace_hint;
     using map::insert;
+#endif
 
     iterator erase(const_iterator pos)
     {
@@ -270,6 +866,16 @@ private:
             _mutation_stamp->stamp++;
         }
     }
+
+#ifdef OTIO_FLAT_ANY_DICTIONARY
+    void added(size_type old_size) noexcept
+    {
+        if (size() != old_size)
+        {
+            mutate();
+        }
+    }
+#endif
 };
 
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
@@ -0,0 +1,311 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#pragma once
+
+#include "opentimelineio/composition.h"
+#include "opentimelineio/serializableCollection.h"
+#include "opentimelineio/timeline.h"
+#include "opentimelineio/version.h"
+
+#include <iterator>
+#include <optional>
+#include <vector>
+
+namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
+
+// A lazy, depth first walk over the descendants of a Composition, Timeline
+// or SerializableCollection that match the given template type.
+//
+// The objects are visited in the same order as find_children() returns
+// them, but each one is found only as the walk reaches it, so a search that
+// stops early only pays for the part of the tree it has seen.  The walk
+// keeps one entry per level of nesting and does not retain the objects it
+// visits, so the tree must not be changed while it is in progress.
+//
+// ChildRange is an input range: it can be iterated over once.
+//
+//     for (Clip* clip: ChildRange<Clip>(timeline, &error_status))
+//     {
+//         if (clip->name() == name)
+//         {
+//             break;
+//         }
+//     }
+//
+// An optional search_range may be provided to limit the search.
+//
+// The search is recursive unless shallow_search is set to true.
+//
+// If an error occurs the walk ends early and error_status is set.
+template <typename T = Composable>
+class ChildRange
+{
+public:
+    class iterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type        = T*;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = T* const*;
+        using reference         = T* const&;
+
+        iterator() = default;
+
+        reference operator*() const { return _range->_current; }
+
+        iterator& operator++()
+        {
+            _range->_advance();
+            return *this;
+        }
+
+        void operator++(int) { _range->_advance(); }
+
+        friend bool operator==(iterator const& lhs, iterator const& rhs)
+        {
+            return lhs._at_end() == rhs._at_end();
+        }
+
+        friend bool operator!=(iterator const& lhs, iterator const& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+        explicit iterator(ChildRange* range)
+            : _range(range)
+        {}
+
+        bool _at_end() const { return !_range || !_range->_current; }
+
+        ChildRange* _range = nullptr;
+
+        friend class ChildRange;
+    };
+
+    ChildRange(
+        Composition const*       composition,
+        ErrorStatus*             error_status   = nullptr,
+        std::optional<TimeRange> search_range   = std::nullopt,
+        bool                     shallow_search = false)
+        : _error_status(error_status)
+        , _shallow_search(shallow_search)
+    {
+        _push(composition, search_range);
+    }
+
+    ChildRange(
+        Timeline const*          timeline,
+        ErrorStatus*             error_status   = nullptr,
+        std::optional<TimeRange> search_range   = std::nullopt,
+        bool                     shallow_search = false)
+        : _error_status(error_status)
+        , _shallow_search(shallow_search)
+    {
+        _push(timeline->tracks(), search_range);
+    }
+
+    ChildRange(
+        SerializableCollection const* collection,
+        ErrorStatus*                  error_status   = nullptr,
+        std::optional<TimeRange>      search_range   = std::nullopt,
+        bool                          shallow_search = false)
+        : _error_status(error_status)
+        , _shallow_search(shallow_search)
+    {
+        _push(collection, search_range);
+    }
+
+    ChildRange(ChildRange const&)            = delete;
+    ChildRange& operator=(ChildRange const&) = delete;
+
+    iterator begin()
+    {
+        if (!_started)
+        {
+            _started = true;
+            _advance();
+        }
+        return iterator(this);
+    }
+
+    iterator end() { return iterator(); }
+
+private:
+    // One level of the walk: the children of either a composition or a
+    // collection, from index up to last.
+    struct Frame
+    {
+        Composition const*            composition;
+        SerializableCollection const* collection;
+        size_t                        index;
+        size_t                        last;
+
+        // The range the children of this level are filtered by, and the
+        // range handed down to nested compositions.
+        std::optional<TimeRange> search_range;
+        std::optional<TimeRange> child_search_range;
+    };
+
+    bool _failed() const { return is_error(_error_status); }
+
+    void _push(
+        Composition const*              composition,
+        std::optional<TimeRange> const& search_range)
+    {
+        size_t first = 0;
+        size_t last  = composition->children().size();
+        if (search_range)
+        {
+            composition->_child_index_span(
+                *search_range,
+                &first,
+                &last,
+                _error_status);
+            if (_failed())
+            {
+                return;
+            }
+        }
+        _frames.push_back(Frame{
+            composition, nullptr, first, last, search_range, search_range });
+    }
+
+    void _push(
+        SerializableCollection const*   collection,
+        std::optional<TimeRange> const& search_range)
+    {
+        _frames.push_back(Frame{ nullptr,
+                                 collection,
+                                 0,
+                                 collection->children().size(),
+                                 search_range,
+                                 search_range });
+    }
+
+    // Move on to the next matching object, or set _current to null once
+    // the walk is over.
+    void _advance()
+    {
+        _current = nullptr;
+        while (!_frames.empty() && !_failed())
+        {
+            Frame& frame = _frames.back();
+            if (frame.index >= frame.last)
+            {
+                _frames.pop_back();
+                continue;
+            }
+
+            const size_t i = frame.index++;
+            if (frame.composition)
+            {
+                _visit_composition_child(frame, i);
+            }
+            else
+            {
+                _visit_collection_child(frame, i);
+            }
+
+            if (_current)
+            {
+                return;
+            }
+        }
+
+        // an error ends the walk
+        _current = nullptr;
+        _frames.clear();
+    }
+
+    void _visit_composition_child(Frame& frame, size_t i)
+    {
+        Composition const* composition = frame.composition;
+        if (frame.search_range)
+        {
+            const bool in_range = composition->_child_in_range(
+                i,
+                *frame.search_range,
+                _error_status);
+            if (_failed() || !in_range)
+            {
+                return;
+            }
+        }
+
+        Composable* child = composition->children()[i].value;
+        T*          match = dynamic_cast<T*>(child);
+
+        // if not a shallow_search, for children that are compositions,
+        // walk their children next
+        if (!_shallow_search)
+        {
+            if (auto child_composition = dynamic_cast<Composition*>(child))
+            {
+                if (frame.child_search_range)
+                {
+                    frame.child_search_range =
+                        composition->transformed_time_range(
+                            *frame.child_search_range,
+                            child_composition,
+                            _error_status);
+                    if (_failed())
+                    {
+                        return;
+                    }
+                }
+
+                // pushing may move frame, so take a copy of the range first
+                auto child_search_range = frame.child_search_range;
+                _push(child_composition, child_search_range);
+                if (_failed())
+                {
+                    return;
+                }
+            }
+        }
+
+        _current = match;
+    }
+
+    void _visit_collection_child(Frame& frame, size_t i)
+    {
+        SerializableObject* child  = frame.collection->children()[i].value;
+        T*                  match  = dynamic_cast<T*>(child);
+        auto                search = frame.search_range;
+
+        // if not a shallow_search, for children that are serializable
+        // collections, compositions, or timelines, walk their children next
+        if (!_shallow_search)
+        {
+            if (auto collection = dynamic_cast<SerializableCollection*>(child))
+            {
+                _push(collection, search);
+            }
+            else if (auto composition = dynamic_cast<Composition*>(child))
+            {
+                _push(composition, search);
+            }
+            else if (auto timeline = dynamic_cast<Timeline*>(child))
+            {
+                _push(timeline->tracks(), search);
+            }
+            if (_failed())
+            {
+                return;
+            }
+        }
+
+        _current = match;
+    }
+
+    ErrorStatus*       _error_status;
+    bool               _shallow_search;
+    bool               _started = false;
+    T*                 _current = nullptr;
+    std::vector<Frame> _frames;
+};
+
+}} // namespace opentimelineio::OPENTIMELINEIO_VERSION
@@ -106,6 +106,8 @@ Clip::set_media_references(
     }
 
     _active_media_reference_key = new_active_key;
+    _hold_media_references();
+    _timing_changed();
 }
 
 std::string
@@ -128,6 +130,7 @@ Clip::set_active_media_reference_key(
         return;
     }
     _active_media_reference_key = new_active_key;
+    _timing_changed();
 }
 
 void
@@ -135,13 +138,29 @@ Clip::set_media_reference(MediaReference* media_reference)
 {
     _media_references[_active_media_reference_key] =
         media_reference ? media_reference : new MissingReference;
+    _hold_media_references();
+    _timing_changed();
+}
+
+void
+Clip::_hold_media_references()
+{
+    for (auto const& m: _media_references)
+    {
+        _hold(m.second.value);
+    }
 }
 
 bool
 Clip::read_from(Reader& reader)
 {
-    return reader.read("media_references", &_media_references)
-           && reader.read(
+    if (!reader.read("media_references", &_media_references))
+    {
+        return false;
+    }
+
+    _hold_media_references();
+    return reader.read(
                "active_media_reference_key",
                &_active_media_reference_key)
            && Parent::read_from(reader);
@@ -155,6 +174,35 @@ Clip::write_to(Writer& writer) const
     writer.write("active_media_reference_key", _active_media_reference_key);
 }
 
+std::type_info const&
+Clip::_direct_class() const
+{
+    return typeid(Clip);
+}
+
+bool
+Clip::_copy_to(SerializableObject* clone, Cloner& cloner) const
+{
+    auto c                         = static_cast<Clip*>(clone);
+    c->_active_media_reference_key = _active_media_reference_key;
+    if (!cloner.copy(_media_references, &c->_media_references))
+    {
+        return false;
+    }
+
+    c->_hold_media_references();
+    return Parent::_copy_to(clone, cloner);
+}
+
+bool
+Clip::_equals(SerializableObject const& other, Comparer& comparer) const
+{
+    auto const& o = static_cast<Clip const&>(other);
+    return _active_media_reference_key == o._active_media_reference_key
+           && Parent::_equals(other, comparer)
+           && comparer.equal(_media_references, o._media_references);
+}
+
 TimeRange
 Clip::available_range(ErrorStatus* error_status) const
 {
@@ -59,6 +59,10 @@ protected:
     bool read_from(Reader&) override;
     void write_to(Writer&) const override;
 
+    std::type_info const& _direct_class() const override;
+    bool _copy_to(SerializableObject* clone, Cloner&) const override;
+    bool _equals(SerializableObject const& other, Comparer&) const override;
+
 private:
     template <typename MediaRefMap>
     bool check_for_valid_media_reference_key(
@@ -67,9 +71,14 @@ private:
         MediaRefMap const& media_references,
         ErrorStatus*       error_status);
 
+    // Have each media reference report its changes to this clip.
+    void _hold_media_references();
+
 private:
     std::map<std::string, Retainer<MediaReference>> _media_references;
     std::string                                     _active_media_reference_key;
+
+    friend class JSONDecoder;
 };
 
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
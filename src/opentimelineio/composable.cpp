@@ -4,11 +4,18 @@
 #include "opentimelineio/composable.h"
 #include "opentimelineio/composition.h"
 
+#include <atomic>
+
 namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
 
+namespace {
+std::atomic<int64_t> _last_modification_stamp{ 0 };
+}
+
 Composable::Composable(std::string const& name, AnyDictionary const& metadata)
     : Parent(name, metadata)
     , _parent(nullptr)
+    , _modification_stamp(0)
 {}
 
 Composable::~Composable()
@@ -49,6 +56,21 @@ Composable::_highest_ancestor() noexcept
     return c;
 }
 
+void
+Composable::_timing_changed() noexcept
+{
+    // stamps come from one shared counter, so that no two changes anywhere
+    // produce the same value
+    const int64_t stamp = ++_last_modification_stamp;
+    _modification_stamp = stamp;
+    for (Composition* c = _parent; c; c = c->_parent)
+    {
+        c->_invalidate_timing_cache();
+        c->_modification_stamp = stamp;
+    }
+    content_changed();
+}
+
 bool
 Composable::read_from(Reader& reader)
 {
@@ -61,6 +83,12 @@ Composable::write_to(Writer& writer) const
     Parent::write_to(writer);
 }
 
+std::type_info const&
+Composable::_direct_class() const
+{
+    return typeid(Composable);
+}
+
 RationalTime
 Composable::duration(ErrorStatus* error_status) const
 {
@@ -32,6 +32,33 @@ public:
 
     Composition* parent() const { return _parent; }
 
+    // A counter that increases whenever one of these setters is called on
+    // this object or on anything below it:
+    //   - Item::set_source_range() and Item::set_enabled()
+    //   - Clip::set_media_reference(), set_media_references() and
+    //     set_active_media_reference_key()
+    //   - Transition::set_in_offset() and set_out_offset()
+    //   - anything that changes the children of a composition
+    //   - Item::effects() (the non-const overload), and the setters of an
+    //     effect held by an item, such as Effect::set_enabled() or
+    //     LinearTimeWarp::set_time_scalar()
+    //   - MediaReference::set_available_range() and
+    //     set_available_image_bounds() on a reference held by a clip; every
+    //     clip holding a shared reference is bumped
+    //
+    // An effect appended through a kept effects() reference is only held
+    // from the next call to effects(), or once the item is read or cloned.
+    // Edits to markers() must be followed by mark_modified().
+    //
+    // Stamps are drawn from a single process-wide counter, so a given value
+    // is never produced by two different changes.
+    int64_t modification_stamp() const noexcept { return _modification_stamp; }
+
+    // Bump the modification stamp of this object and its ancestors.  Call
+    // this after editing markers() in place, or after changing an object
+    // that is not itself a Composable and does not report its changes.
+    void mark_modified() noexcept { _timing_changed(); }
+
     virtual RationalTime duration(ErrorStatus* error_status = nullptr) const;
 
     virtual std::optional<IMATH_NAMESPACE::Box2d>
@@ -41,6 +68,11 @@ protected:
     bool        _set_parent(Composition*) noexcept;
     Composable* _highest_ancestor() noexcept;
 
+    // Let this object and its ancestors know that something affecting its
+    // timing has changed, so that they bump their modification stamps and
+    // drop any cached timing data.
+    void _timing_changed() noexcept;
+
     Composable const* _highest_ancestor() const noexcept
     {
         return const_cast<Composable*>(this)->_highest_ancestor();
@@ -51,8 +83,11 @@ protected:
     bool read_from(Reader&) override;
     void write_to(Writer&) const override;
 
+    std::type_info const& _direct_class() const override;
+
 private:
     Composition* _parent;
+    int64_t      _modification_stamp;
     friend class Composition;
 };
 
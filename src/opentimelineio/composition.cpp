@@ -5,6 +5,7 @@
 #include "opentimelineio/clip.h"
 #include "opentimelineio/vectorIndexing.h"
 
+#include <algorithm>
 #include <assert.h>
 #include <set>
 
@@ -31,6 +32,40 @@ Composition::composition_kind() const
     return kind;
 }
 
+TimeRange
+Composition::available_range(ErrorStatus* error_status) const
+{
+    {
+        std::lock_guard<std::mutex> lock(_timing_cache_mutex);
+        if (_available_range_cache)
+        {
+            return *_available_range_cache;
+        }
+    }
+
+    // errors are not cached, so that they are reported on every call
+    ErrorStatus status;
+    TimeRange   range = _compute_available_range(&status);
+    if (is_error(status))
+    {
+        if (error_status)
+        {
+            *error_status = status;
+        }
+        return range;
+    }
+
+    std::lock_guard<std::mutex> lock(_timing_cache_mutex);
+    _available_range_cache = range;
+    return range;
+}
+
+TimeRange
+Composition::_compute_available_range(ErrorStatus* error_status) const
+{
+    return Parent::available_range(error_status);
+}
+
 void
 Composition::clear_children()
 {
@@ -40,7 +75,8 @@ Composition::clear_children()
     }
 
     _children.clear();
-    _child_set.clear();
+    _child_index.clear();
+    _children_changed();
 }
 
 bool
@@ -65,8 +101,9 @@ Composition::set_children(
         child->_set_parent(this);
     }
 
-    _children  = decltype(_children)(children.begin(), children.end());
-    _child_set = std::set<Composable*>(children.begin(), children.end());
+    _children = decltype(_children)(children.begin(), children.end());
+    _index_children();
+    _children_changed();
     return true;
 }
 
@@ -91,13 +128,16 @@ Composition::insert_child(
     if (index >= int(_children.size()))
     {
         _children.emplace_back(child);
+        _index_children(_children.size() - 1);
     }
     else
     {
-        _children.insert(_children.begin() + std::max(index, 0), child);
+        index = std::max(index, 0);
+        _children.insert(_children.begin() + index, child);
+        _index_children(index);
     }
 
-    _child_set.insert(child);
+    _children_changed();
     return true;
 }
 
@@ -126,10 +166,11 @@ Composition::set_child(int index, Composable* child, ErrorStatus* error_status)
         }
 
         _children[index]->_set_parent(nullptr);
-        _child_set.erase(_children[index]);
+        _child_index.erase(_children[index]);
         child->_set_parent(this);
-        _children[index] = child;
-        _child_set.insert(child);
+        _children[index]    = child;
+        _child_index[child] = index;
+        _children_changed();
     }
     return true;
 }
@@ -148,20 +189,22 @@ Composition::remove_child(int index, ErrorStatus* error_status)
 
     index = adjusted_vector_index(index, _children);
 
-    _child_set.erase(_children[index]);
-
     if (size_t(index) >= _children.size())
     {
         _children.back()->_set_parent(nullptr);
+        _child_index.erase(_children.back());
         _children.pop_back();
     }
     else
     {
         index = std::max(index, 0);
         _children[index]->_set_parent(nullptr);
+        _child_index.erase(_children[index]);
         _children.erase(_children.begin() + index);
+        _index_children(index);
     }
 
+    _children_changed();
     return true;
 }
 
@@ -169,12 +212,10 @@ int
 Composition::index_of_child(Composable const* child, ErrorStatus* error_status)
     const
 {
-    for (size_t i = 0; i < _children.size(); i++)
+    auto it = _child_index.find(child);
+    if (it != _child_index.end())
     {
-        if (_children[i] == child)
-        {
-            return int(i);
-        }
+        return it->second;
     }
 
     if (error_status)
@@ -190,15 +231,35 @@ Composition::read_from(Reader& reader)
 {
     if (reader.read("children", &_children) && Parent::read_from(reader))
     {
-        for (Composable* child: _children)
+        if (!_adopt_children())
+        {
+            reader.error(ErrorStatus::CHILD_ALREADY_PARENTED);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool
+Composition::_adopt_children()
+{
+    for (auto child = _children.begin(); child != _children.end(); ++child)
+    {
+        if (!(*child)->_set_parent(this))
         {
-            if (!child->_set_parent(this))
+            for (auto adopted = _children.begin(); adopted != child; ++adopted)
             {
-                reader.error(ErrorStatus::CHILD_ALREADY_PARENTED);
-                return false;
+                if ((*adopted)->parent() == this)
+                {
+                    (*adopted)->_set_parent(nullptr);
+                }
             }
+            _children.clear();
+            return false;
         }
     }
+    _index_children();
+    _children_changed();
     return true;
 }
 
@@ -209,6 +270,73 @@ Composition::write_to(Writer& writer) const
     writer.write("children", _children);
 }
 
+std::type_info const&
+Composition::_direct_class() const
+{
+    return typeid(Composition);
+}
+
+bool
+Composition::_copy_to(SerializableObject* clone, Cloner& cloner) const
+{
+    auto c = static_cast<Composition*>(clone);
+    if (!cloner.copy(_children, &c->_children)
+        || !Parent::_copy_to(clone, cloner))
+    {
+        return false;
+    }
+
+    for (Composable* child: c->_children)
+    {
+        if (!child->_set_parent(c))
+        {
+            cloner.error(ErrorStatus::CHILD_ALREADY_PARENTED);
+            return false;
+        }
+    }
+    c->_index_children();
+    c->_children_changed();
+    return true;
+}
+
+bool
+Composition::_equals(SerializableObject const& other, Comparer& comparer) const
+{
+    auto const& o = static_cast<Composition const&>(other);
+    return Parent::_equals(other, comparer)
+           && comparer.equal(_children, o._children);
+}
+
+void
+Composition::_invalidate_timing_cache() noexcept
+{
+    std::lock_guard<std::mutex> lock(_timing_cache_mutex);
+    _child_ranges_cache.reset();
+    _available_range_cache.reset();
+}
+
+void
+Composition::_children_changed() noexcept
+{
+    _invalidate_timing_cache();
+    _timing_changed();
+}
+
+void
+Composition::_index_children(size_t first)
+{
+    if (first == 0)
+    {
+        _child_index.clear();
+        _child_index.reserve(_children.size());
+    }
+
+    for (size_t i = first; i < _children.size(); i++)
+    {
+        _child_index[_children[i]] = int(i);
+    }
+}
+
 bool
 Composition::is_parent_of(Composable const* other) const
 {
@@ -287,6 +415,45 @@ Composition::trimmed_range_of_child_at_index(
     return TimeRange();
 }
 
+void
+Composition::child_ranges(
+    std::vector<TimeRange>* ranges,
+    ErrorStatus*            error_status) const
+{
+    ranges->clear();
+
+    // subclasses written before child_ranges() existed only override
+    // range_of_all_children(), so take the ranges from there
+    ErrorStatus status;
+    auto        range_map = range_of_all_children(&status);
+    if (is_error(status))
+    {
+        if (error_status)
+        {
+            *error_status = status;
+        }
+        return;
+    }
+
+    ranges->reserve(_children.size());
+    for (auto const& child: _children)
+    {
+        auto it = range_map.find(child);
+        if (it == range_map.end())
+        {
+            ranges->clear();
+            if (error_status)
+            {
+                *error_status = ErrorStatus(
+                    ErrorStatus::INTERNAL_ERROR,
+                    "range_of_all_children() has no range for a child");
+            }
+            return;
+        }
+        ranges->push_back(it->second);
+    }
+}
+
 std::map<Composable*, TimeRange>
 Composition::range_of_all_children(ErrorStatus* error_status) const
 {
@@ -297,6 +464,20 @@ Composition::range_of_all_children(ErrorStatus* error_status) const
     return std::map<Composable*, TimeRange>();
 }
 
+std::map<Composable*, TimeRange>
+Composition::_child_range_map(ErrorStatus* error_status) const
+{
+    std::map<Composable*, TimeRange> result;
+    std::vector<TimeRange>           ranges;
+    child_ranges(&ranges, error_status);
+    const size_t count = std::min(ranges.size(), _children.size());
+    for (size_t i = 0; i < count; i++)
+    {
+        result[_children[i]] = ranges[i];
+    }
+    return result;
+}
+
 // XXX should have reference_space argument or something
 TimeRange
 Composition::range_of_child(Composable const* child, ErrorStatus* error_status)
@@ -470,7 +651,39 @@ Composition::trim_child_range(TimeRange child_range) const
 bool
 Composition::has_child(Composable* child) const
 {
-    return _child_set.find(child) != _child_set.end();
+    return _child_index.find(child) != _child_index.end();
+}
+
+std::shared_ptr<std::vector<TimeRange> const>
+Composition::_cached_child_ranges(ErrorStatus* error_status) const
+{
+    {
+        std::lock_guard<std::mutex> lock(_timing_cache_mutex);
+        if (_child_ranges_cache)
+        {
+            return _child_ranges_cache;
+        }
+    }
+
+    // built without the lock, which subclasses take to fill their own
+    // caches; readers may still hold the old table, so build a new one
+    auto        ranges = std::make_shared<std::vector<TimeRange>>();
+    ErrorStatus status;
+    child_ranges(ranges.get(), &status);
+
+    // don't keep or hand out a partial table
+    if (is_error(status))
+    {
+        if (error_status)
+        {
+            *error_status = status;
+        }
+        return std::make_shared<std::vector<TimeRange> const>();
+    }
+
+    std::lock_guard<std::mutex> lock(_timing_cache_mutex);
+    _child_ranges_cache = ranges;
+    return _child_ranges_cache;
 }
 
 SerializableObject::Retainer<Composable>
@@ -481,57 +694,36 @@ Composition::child_at_time(
 {
     Retainer<Composable> result;
 
-    auto range_map = range_of_all_children(error_status);
+    auto const  table  = _cached_child_ranges(error_status);
+    auto const& ranges = *table;
     if (is_error(error_status))
     {
         return result;
     }
 
     // find the first item whose end_time_exclusive is after the
-    const auto first_inside_range = _bisect_left(
-        search_time,
-        [&range_map](Composable* child) {
-            return range_map[child].end_time_exclusive();
-        },
-        error_status);
-    if (is_error(error_status))
-    {
-        return result;
-    }
+    const auto first_inside_range =
+        _bisect_left(search_time, ranges, &TimeRange::end_time_exclusive);
 
     // find the last item whose start_time is before the
     const auto last_in_range = _bisect_right(
         search_time,
-        [&range_map](Composable* child) {
-            return range_map[child].start_time();
-        },
-        error_status,
+        ranges,
+        &TimeRange::start_time,
         first_inside_range);
-    if (is_error(error_status))
-    {
-        return result;
-    }
 
     // limit the search to children who are in the search_range
-    std::vector<Retainer<Composable>> possible_matches;
-    for (auto child = _children.begin() + first_inside_range;
-         child < _children.begin() + last_in_range;
-         ++child)
-    {
-        possible_matches.push_back(child->value);
-    }
-    for (const auto& thing: possible_matches)
+    for (size_t i = first_inside_range; i < last_in_range; i++)
     {
-        if (range_map[thing].overlaps(search_time))
+        if (ranges[i].overlaps(search_time))
         {
-            result = thing;
+            result = _children[i];
             break;
         }
     }
 
     // if the search cannot or should not continue
-    auto composition =
-        Retainer<Composition>(dynamic_cast<Composition*>(result.value));
+    auto composition = dynamic_cast<Composition*>(result.value);
     if (!result || shallow_search || !composition)
     {
         return result;
@@ -540,13 +732,13 @@ Composition::child_at_time(
     // before you recurse, you have to transform the time into the
     // space of the child
     const auto child_search_time =
-        transformed_time(search_time, composition.value, error_status);
+        transformed_time(search_time, composition, error_status);
     if (is_error(error_status))
     {
         return result;
     }
 
-    result = composition.value->child_at_time(
+    result = composition->child_at_time(
         child_search_time,
         error_status,
         shallow_search);
@@ -564,78 +756,86 @@ Composition::children_in_range(
 {
     std::vector<Retainer<Composable>> children;
 
-    auto range_map = range_of_all_children(error_status);
+    size_t first = 0;
+    size_t last  = 0;
+    _child_index_span(search_range, &first, &last, error_status);
     if (is_error(error_status))
     {
         return children;
     }
 
+    for (size_t i = first; i < last; i++)
+    {
+        if (_child_in_range(i, search_range, error_status))
+        {
+            children.push_back(_children[i]);
+        }
+    }
+    return children;
+}
+
+void
+Composition::_child_index_span(
+    TimeRange const& search_range,
+    size_t*          first,
+    size_t*          last,
+    ErrorStatus*     error_status) const
+{
+    *first = *last = 0;
+
+    auto const  table  = _cached_child_ranges(error_status);
+    auto const& ranges = *table;
+    if (is_error(error_status))
+    {
+        return;
+    }
+
     // find the first item whose end_time_inclusive is after the
     // start_time of the search range
     const auto first_inside_range = _bisect_left(
         search_range.start_time(),
-        [&range_map](Composable* child) {
-            return range_map[child].end_time_inclusive();
-        },
-        error_status);
-    if (is_error(error_status))
-    {
-        return children;
-    }
+        ranges,
+        &TimeRange::end_time_inclusive);
 
     // find the last item whose start_time is before the
     // end_time_inclusive of the search_range
     const auto last_in_range = _bisect_right(
         search_range.end_time_inclusive(),
-        [&range_map](Composable* child) {
-            return range_map[child].start_time();
-        },
-        error_status,
+        ranges,
+        &TimeRange::start_time,
         first_inside_range);
-    if (is_error(error_status))
-    {
-        return children;
-    }
 
-    // limit the search to children who are in the search_range
-    for (auto child = _children.begin() + first_inside_range;
-         child < _children.begin() + last_in_range;
-         ++child)
+    if (last_in_range > first_inside_range)
     {
-        children.push_back(child->value);
+        *first = first_inside_range;
+        *last  = last_in_range;
     }
-    return children;
 }
 
-int64_t
+bool
+Composition::_child_in_range(
+    size_t /* index */,
+    TimeRange const& /* search_range */,
+    ErrorStatus* /* error_status */) const
+{
+    // every child in the span given by _child_index_span() is in range
+    return true;
+}
+
+size_t
 Composition::_bisect_right(
-    RationalTime const&                             tgt,
-    std::function<RationalTime(Composable*)> const& key_func,
-    ErrorStatus*                                    error_status,
-    std::optional<int64_t>                          lower_search_bound,
-    std::optional<int64_t>                          upper_search_bound) const
+    RationalTime const&           tgt,
+    std::vector<TimeRange> const& ranges,
+    RationalTime (TimeRange::*key_func)() const,
+    size_t lower_search_bound)
 {
-    if (*lower_search_bound < 0)
+    size_t upper_search_bound = ranges.size();
+    while (lower_search_bound < upper_search_bound)
     {
-        if (error_status)
-        {
-            *error_status = ErrorStatus(
-                ErrorStatus::Outcome::INTERNAL_ERROR,
-                "lower_search_bound must be non-negative");
-        }
-        return 0;
-    }
-    if (!upper_search_bound)
-    {
-        upper_search_bound = std::optional<int64_t>(_children.size());
-    }
-    int64_t midpoint_index = 0;
-    while (*lower_search_bound < *upper_search_bound)
-    {
-        midpoint_index = static_cast<int64_t>(
-            std::floor((*lower_search_bound + *upper_search_bound) / 2.0));
+        const size_t midpoint_index =
+            lower_search_bound + (upper_search_bound - lower_search_bound) / 2;
 
-        if (tgt < key_func(_children[midpoint_index]))
+        if (tgt < (ranges[midpoint_index].*key_func)())
         {
             upper_search_bound = midpoint_index;
         }
@@ -645,38 +845,23 @@ Composition::_bisect_right(
         }
     }
 
-    return *lower_search_bound;
+    return lower_search_bound;
 }
 
-int64_t
+size_t
 Composition::_bisect_left(
-    RationalTime const&                             tgt,
-    std::function<RationalTime(Composable*)> const& key_func,
-    ErrorStatus*                                    error_status,
-    std::optional<int64_t>                          lower_search_bound,
-    std::optional<int64_t>                          upper_search_bound) const
+    RationalTime const&           tgt,
+    std::vector<TimeRange> const& ranges,
+    RationalTime (TimeRange::*key_func)() const,
+    size_t lower_search_bound)
 {
-    if (*lower_search_bound < 0)
-    {
-        if (error_status)
-        {
-            *error_status = ErrorStatus(
-                ErrorStatus::Outcome::INTERNAL_ERROR,
-                "lower_search_bound must be non-negative");
-        }
-        return 0;
-    }
-    if (!upper_search_bound)
-    {
-        upper_search_bound = std::optional<int64_t>(_children.size());
-    }
-    int64_t midpoint_index = 0;
-    while (*lower_search_bound < *upper_search_bound)
+    size_t upper_search_bound = ranges.size();
+    while (lower_search_bound < upper_search_bound)
     {
-        midpoint_index = static_cast<int64_t>(
-            std::floor((*lower_search_bound + *upper_search_bound) / 2.0));
+        const size_t midpoint_index =
+            lower_search_bound + (upper_search_bound - lower_search_bound) / 2;
 
-        if (key_func(_children[midpoint_index]) < tgt)
+        if ((ranges[midpoint_index].*key_func)() < tgt)
         {
             lower_search_bound = midpoint_index + 1;
         }
@@ -686,7 +871,7 @@ Composition::_bisect_left(
         }
     }
 
-    return *lower_search_bound;
+    return lower_search_bound;
 }
 
 bool
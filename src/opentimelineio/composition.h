@@ -5,10 +5,15 @@
 
 #include "opentimelineio/item.h"
 #include "opentimelineio/version.h"
-#include <set>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
 
+template <typename T>
+class ChildRange;
+
 class Composition : public Item
 {
 public:
@@ -29,6 +34,12 @@ public:
 
     virtual std::string composition_kind() const;
 
+    // The result of _compute_available_range(), kept until the timing of
+    // the children changes, so repeated duration queries on a large tree do
+    // not walk it again.
+    TimeRange
+    available_range(ErrorStatus* error_status = nullptr) const override;
+
     std::vector<Retainer<Composable>> const& children() const noexcept
     {
         return _children;
@@ -89,6 +100,22 @@ public:
 
     bool has_clips() const;
 
+    // Write the range of every child into ranges, in the same order as
+    // children().  The storage already held by ranges is reused.
+    //
+    // child_at_time(), children_in_range() and the algorithms get the ranges
+    // from here.  The default takes them from range_of_all_children(), so
+    // subclasses that only override that keep working, but subclasses
+    // should override this instead, and override range_of_all_children()
+    // with _child_range_map().
+    virtual void child_ranges(
+        std::vector<TimeRange>* ranges,
+        ErrorStatus*            error_status = nullptr) const;
+
+    // Return the range of every child, keyed by child.
+    //
+    // This is kept for compatibility; prefer child_ranges(), which neither
+    // allocates a tree node per child nor loses the order of the children.
     virtual std::map<Composable*, TimeRange>
     range_of_all_children(ErrorStatus* error_status = nullptr) const;
 
@@ -105,6 +132,21 @@ public:
         TimeRange const& search_range,
         ErrorStatus*     error_status = nullptr) const;
 
+    // Call fn with a pointer to each child object that matches the given
+    // template type, in the same order as find_children().  The pointers are
+    // not retained and nothing is allocated, so fn must not change the
+    // structure of the composition.
+    //
+    // An optional search_range may be provided to limit the search.
+    //
+    // The search is recursive unless shallow_search is set to true.
+    template <typename T = Composable, typename Fn>
+    void for_each_child(
+        Fn&&                     fn,
+        ErrorStatus*             error_status   = nullptr,
+        std::optional<TimeRange> search_range   = std::nullopt,
+        bool                     shallow_search = false) const;
+
     // Find child objects that match the given template type.
     //
     // An optional search_time may be provided to limit the search.
@@ -122,117 +164,211 @@ protected:
     bool read_from(Reader&) override;
     void write_to(Writer&) const override;
 
+    std::type_info const& _direct_class() const override;
+    bool _copy_to(SerializableObject* clone, Cloner&) const override;
+    bool _equals(SerializableObject const& other, Comparer&) const override;
+
     std::vector<Composition*> _path_from_child(
         Composable const* child,
         ErrorStatus*      error_status = nullptr) const;
 
+    // Return the ranges from child_ranges(), keyed by child.
+    std::map<Composable*, TimeRange>
+    _child_range_map(ErrorStatus* error_status = nullptr) const;
+
+    // Drop any timing data cached from the children.  Called whenever the
+    // children change, or the timing of one of their descendants does.
+    virtual void _invalidate_timing_cache() noexcept;
+
+    // Guards the timing caches of this object, including those added by
+    // subclasses, since they are all dropped together.  It is only held to
+    // read or store a cache, never while computing the timing of this
+    // object, though a subclass may hold it while asking its children.
+    mutable std::mutex _timing_cache_mutex;
+
+    // Set [*first, *last) to the indices of the children that may lie within
+    // search_range.  Children outside of it are not considered further.
+    virtual void _child_index_span(
+        TimeRange const& search_range,
+        size_t*          first,
+        size_t*          last,
+        ErrorStatus*     error_status = nullptr) const;
+
+    // Return whether the child at index, which lies within the span given by
+    // _child_index_span(), is in search_range.
+    virtual bool _child_in_range(
+        size_t           index,
+        TimeRange const& search_range,
+        ErrorStatus*     error_status = nullptr) const;
+
+    // Compute the available range from the children.  Subclasses override
+    // this rather than available_range(), which caches the result.
+    virtual TimeRange
+    _compute_available_range(ErrorStatus* error_status = nullptr) const;
+
 private:
+    void _children_changed() noexcept;
+
+    // Make the children just read this composition's own, returning false
+    // if one of them already has a parent.  On failure the children are
+    // dropped, and none is left with this composition as its parent, so
+    // destroying the composition doesn't touch the parent of another.
+    bool _adopt_children();
+
+    // Record the position of every child from index first onwards.
+    void _index_children(size_t first = 0);
+
     // XXX: python implementation is O(n^2) in number of children
     std::vector<Composable*>
     _children_at_time(RationalTime, ErrorStatus* error_status = nullptr) const;
 
-    // Return the index of the last item in seq such that all e in seq[:index]
-    // have key_func(e) <= tgt, and all e in seq[index:] have key_func(e) > tgt.
+    // The ranges of all children as computed by child_ranges().  The table
+    // is built on first use and kept until the timing of the children
+    // changes.  A table is never changed once built, so it stays valid for
+    // as long as the caller holds it, even if it is replaced meanwhile.  If
+    // the ranges cannot be computed the table is empty.
+    std::shared_ptr<std::vector<TimeRange> const>
+    _cached_child_ranges(ErrorStatus* error_status = nullptr) const;
+
+    // Return the index of the last item in ranges such that all e in
+    // ranges[:index] have (e.*key_func)() <= tgt, and all e in ranges[index:]
+    // have (e.*key_func)() > tgt.
     //
-    // Thus, seq.insert(index, value) will insert value after the rightmost item
-    // such that meets the above condition.
+    // Thus, ranges.insert(index, value) will insert value after the rightmost
+    // item such that meets the above condition.
     //
-    // lower_search_bound and upper_search_bound bound the slice to be searched.
+    // lower_search_bound bounds the slice to be searched.
     //
-    // Assumes that seq is already sorted.
-    int64_t _bisect_right(
-        RationalTime const&                             tgt,
-        std::function<RationalTime(Composable*)> const& key_func,
-        ErrorStatus*                                    error_status = nullptr,
-        std::optional<int64_t> lower_search_bound = std::optional<int64_t>(0),
-        std::optional<int64_t> upper_search_bound = std::nullopt) const;
-
-    // Return the index of the last item in seq such that all e in seq[:index]
-    // have key_func(e) < tgt, and all e in seq[index:] have key_func(e) >= tgt.
+    // Assumes that ranges is already sorted.
+    static size_t _bisect_right(
+        RationalTime const&           tgt,
+        std::vector<TimeRange> const& ranges,
+        RationalTime (TimeRange::*key_func)() const,
+        size_t lower_search_bound = 0);
+
+    // Return the index of the last item in ranges such that all e in
+    // ranges[:index] have (e.*key_func)() < tgt, and all e in ranges[index:]
+    // have (e.*key_func)() >= tgt.
     //
-    // Thus, seq.insert(index, value) will insert value before the leftmost item
-    // such that meets the above condition.
+    // Thus, ranges.insert(index, value) will insert value before the leftmost
+    // item such that meets the above condition.
     //
-    // lower_search_bound and upper_search_bound bound the slice to be searched.
+    // lower_search_bound bounds the slice to be searched.
     //
-    // Assumes that seq is already sorted.
-    int64_t _bisect_left(
-        RationalTime const&                             tgt,
-        std::function<RationalTime(Composable*)> const& key_func,
-        ErrorStatus*                                    error_status = nullptr,
-        std::optional<int64_t> lower_search_bound = std::optional<int64_t>(0),
-        std::optional<int64_t> upper_search_bound = std::nullopt) const;
+    // Assumes that ranges is already sorted.
+    static size_t _bisect_left(
+        RationalTime const&           tgt,
+        std::vector<TimeRange> const& ranges,
+        RationalTime (TimeRange::*key_func)() const,
+        size_t lower_search_bound = 0);
 
     std::vector<Retainer<Composable>> _children;
 
-    // This is for fast lookup only, and varies automatically
-    // as _children is mutated.
-    std::set<Composable*> _child_set;
+    // The position of each child in _children, for fast lookup only.  It is
+    // kept up to date by every method that mutates _children.
+    std::unordered_map<Composable const*, int> _child_index;
+
+    // null until built, and after the timing of the children changes
+    mutable std::shared_ptr<std::vector<TimeRange> const> _child_ranges_cache;
+
+    mutable std::optional<TimeRange> _available_range_cache;
+
+    friend class Composable;
+    friend class JSONDecoder;
+
+    template <typename T>
+    friend class ChildRange;
 };
 
-template <typename T>
-inline std::vector<SerializableObject::Retainer<T>>
-Composition::find_children(
+template <typename T, typename Fn>
+inline void
+Composition::for_each_child(
+    Fn&&                     fn,
     ErrorStatus*             error_status,
     std::optional<TimeRange> search_range,
     bool                     shallow_search) const
 {
-    std::vector<Retainer<T>>          out;
-    std::vector<Retainer<Composable>> children;
+    // limit the search to children who are in the search_range, otherwise
+    // search all the children
+    size_t first = 0;
+    size_t last  = _children.size();
     if (search_range)
     {
-        // limit the search to children who are in the search_range
-        children = children_in_range(*search_range, error_status);
+        _child_index_span(*search_range, &first, &last, error_status);
         if (is_error(error_status))
         {
-            return out;
+            return;
         }
     }
-    else
-    {
-        // otherwise search all the children
-        children = _children;
-    }
-    for (const auto& child: children)
+
+    std::optional<TimeRange> child_search_range = search_range;
+    for (size_t i = first; i < last; i++)
     {
-        if (auto valid_child = dynamic_cast<T*>(child.value))
+        if (search_range)
         {
-            out.push_back(valid_child);
+            const bool in_range =
+                _child_in_range(i, *search_range, error_status);
+            if (is_error(error_status))
+            {
+                return;
+            }
+            if (!in_range)
+            {
+                continue;
+            }
+        }
+
+        Composable* child = _children[i].value;
+        if (auto valid_child = dynamic_cast<T*>(child))
+        {
+            fn(valid_child);
         }
 
         // if not a shallow_search, for children that are compositions,
         // recurse into their children
         if (!shallow_search)
         {
-            if (auto composition = dynamic_cast<Composition*>(child.value))
+            if (auto composition = dynamic_cast<Composition*>(child))
             {
-                if (search_range)
+                if (child_search_range)
                 {
-                    search_range = transformed_time_range(
-                        *search_range,
+                    child_search_range = transformed_time_range(
+                        *child_search_range,
                         composition,
                         error_status);
                     if (is_error(error_status))
                     {
-                        return out;
+                        return;
                     }
                 }
 
-                const auto valid_children = composition->find_children<T>(
+                composition->for_each_child<T>(
+                    fn,
                     error_status,
-                    search_range,
+                    child_search_range,
                     shallow_search);
                 if (is_error(error_status))
                 {
-                    return out;
-                }
-                for (const auto& valid_child: valid_children)
-                {
-                    out.push_back(valid_child);
+                    return;
                 }
             }
         }
     }
+}
+
+template <typename T>
+inline std::vector<SerializableObject::Retainer<T>>
+Composition::find_children(
+    ErrorStatus*             error_status,
+    std::optional<TimeRange> search_range,
+    bool                     shallow_search) const
+{
+    std::vector<Retainer<T>> out;
+    for_each_child<T>(
+        [&out](T* child) { out.emplace_back(child); },
+        error_status,
+        search_range,
+        shallow_search);
     return out;
 }
 
@@ -4,14 +4,30 @@
 #include "opentime/rationalTime.h"
 #include "opentime/timeRange.h"
 #include "opentime/timeTransform.h"
+#include "opentimelineio/clip.h"
+#include "opentimelineio/effect.h"
+#include "opentimelineio/externalReference.h"
+#include "opentimelineio/gap.h"
+#include "opentimelineio/marker.h"
+#include "opentimelineio/safely_typed_any.h"
 #include "opentimelineio/serializableObject.h"
 #include "opentimelineio/serializableObjectWithMetadata.h"
+#include "opentimelineio/stack.h"
+#include "opentimelineio/track.h"
 #include "stringUtils.h"
 
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
 #define RAPIDJSON_NAMESPACE OTIO_rapidjson
 #include <rapidjson/cursorstreamwrapper.h>
 #include <rapidjson/error/en.h>
-#include <rapidjson/filereadstream.h>
 #include <rapidjson/reader.h>
 
 #if defined(_WINDOWS)
@@ -22,7 +38,12 @@
 #        define NOMINMAX
 #    endif // NOMINMAX
 #    include <windows.h>
-#endif
+#else // _WINDOWS
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif // _WINDOWS
 
 namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
 
@@ -60,21 +81,57 @@ public:
     bool Bool(bool b) { return store(std::any(b)); }
 
     // coerce all integer types to int64_t...
-    bool Int(int i) { return store(std::any(static_cast<int64_t>(i))); }
-    bool Int64(int64_t i) { return store(std::any(static_cast<int64_t>(i))); }
-    bool Uint(unsigned u) { return store(std::any(static_cast<int64_t>(u))); }
+    bool Int(int i)
+    {
+        return store_number(static_cast<int64_t>(i));
+    }
+    bool Int64(int64_t i)
+    {
+        return store_number(static_cast<int64_t>(i));
+    }
+    bool Uint(unsigned u)
+    {
+        return store_number(static_cast<int64_t>(u));
+    }
     bool Uint64(uint64_t u)
     {
         /// prevent an overflow
-        return store(std::any(static_cast<int64_t>(u & 0x7FFFFFFFFFFFFFFF)));
+        return store_number(static_cast<int64_t>(u & 0x7FFFFFFFFFFFFFFF));
     }
 
     // ...and all floating point types to double
-    bool Double(double d) { return store(std::any(d)); }
+    bool Double(double d) { return store_number(d); }
 
     bool
     String(const char* str, OTIO_rapidjson::SizeType length, bool /* copy */)
     {
+        if (!has_errored() && !_stack.empty() && _stack.back().schema_pending)
+        {
+            // the object's first key was OTIO_SCHEMA; if it names one of the
+            // value schemas, decode the object straight into a value, and if
+            // it names one of the core object schemas, into its fields
+            auto& top          = _stack.back();
+            top.schema_pending = false;
+            if (auto schema = _ValueSchema::find(str, length))
+            {
+                top.value_schema = schema;
+                return true;
+            }
+            if (auto schema = _ObjectSchema::find(str, length))
+            {
+                top.object_schema = schema;
+                return true;
+            }
+        }
+
+        // a field of a core object is only needed until the object is built
+        if (!_stack.empty() && _stack.back().object_schema
+            && _stack.back().cur_field >= 0)
+        {
+            char* chars = _arena.allocate(length);
+            std::memcpy(chars, str, length);
+            return store(_arena.make(std::string_view(chars, length)));
+        }
         return store(std::any(std::string(str, length)));
     }
 
@@ -92,7 +149,31 @@ public:
             return false;
         }
 
-        _stack.back().cur_key = std::string(str, length);
+        auto& top = _stack.back();
+        if (top.value_schema)
+        {
+            const int field = top.value_schema->field_index(str, length);
+            if (field >= 0 && !(top.fields_set & (1u << field)))
+            {
+                top.cur_field = field;
+                return true;
+            }
+            _demote(top);
+        }
+        else if (top.object_schema)
+        {
+            const int field = top.object_schema->field_index(str, length);
+            if (field >= 0 && !(top.fields_set & (1u << field)))
+            {
+                top.cur_field = field;
+                return true;
+            }
+            _demote(top);
+        }
+
+        top.schema_pending = top.dict.empty() && length == 11
+                             && std::memcmp(str, "OTIO_SCHEMA", 11) == 0;
+        top.cur_key.assign(str, length);
         return true;
     }
 
@@ -103,6 +184,7 @@ public:
             return false;
         }
 
+        _demote_top();
         _stack.emplace_back(_DictOrArray{ false /* is_dict*/ });
         return true;
     }
@@ -114,7 +196,23 @@ public:
             return false;
         }
 
+        // a value object may hold nested value objects, but nothing else
+        if (!_stack.empty())
+        {
+            auto& top = _stack.back();
+            if (top.value_schema
+                && (top.cur_field < 0
+                    || top.value_schema->fields[top.cur_field].kind
+                           == _ValueSchema::number))
+            {
+                _demote(top);
+            }
+            top.schema_pending = false;
+        }
+
         _stack.emplace_back(_DictOrArray{ true /* is_dict*/ });
+        _stack.back().reference_count = _resolver.reference_count;
+        _stack.back().arena_mark      = _arena.mark();
         return true;
     }
 
@@ -171,17 +269,39 @@ public:
                     "JSONDecoder::_handle_end_object() called without matching _handle_start_object");
                 _stack.pop_back();
             }
+            else if (top.value_schema && top.value_schema->complete(top))
+            {
+                // the fields are held in top itself, so the arena can be
+                // rewound before the value is made in it
+                _arena.rewind(top.arena_mark);
+                std::any value = top.value_schema->make(top, _arena);
+                _stack.pop_back();
+                store_field(std::move(value));
+            }
+            else if (SerializableObject* so = _make_object(top))
+            {
+                _arena.rewind(top.arena_mark);
+                _stack.pop_back();
+                store_field(std::any(SerializableObject::Retainer<>(so)));
+            }
             else
             {
+                // an object with missing or unexpected fields takes the
+                // general path, which reports the error
+                _demote(top);
+                _arena.rewind(top.arena_mark);
+
                 // when we end a dictionary, we immediately convert it
                 // to the type it really represents, if it is a schema object.
+                const bool has_references =
+                    _resolver.reference_count != top.reference_count;
                 SerializableObject::Reader reader(
                     top.dict,
                     _error_function,
                     nullptr,
-                    static_cast<int>(_line_number_function()));
+                    _line_number());
                 _stack.pop_back();
-                store(reader._decode(_resolver));
+                store_field(reader._decode(_resolver, has_references));
             }
         }
         return true;
@@ -194,25 +314,91 @@ public:
             return false;
         }
 
+        _demote_top();
         if (_stack.empty())
         {
-            _root.swap(a);
+            _root.swap(_from_arena(a));
         }
         else
         {
             auto& top = _stack.back();
-            if (top.is_dict)
+            if (top.object_schema && top.cur_field >= 0)
+            {
+                top.object_fields[top.cur_field] = std::move(a);
+                top.fields_set |= 1u << top.cur_field;
+                top.cur_field = -1;
+            }
+            else if (top.is_dict)
             {
-                top.dict.emplace(_stack.back().cur_key, a);
+                top.dict.emplace(
+                    std::move(top.cur_key),
+                    std::move(_from_arena(a)));
             }
             else
             {
-                top.array.emplace_back(a);
+                top.array.emplace_back(std::move(_from_arena(a)));
             }
         }
         return true;
     }
 
+    // Store a number, straight into a field of a value object if one is
+    // waiting for it.
+    template <typename T>
+    bool store_number(T n)
+    {
+        if (!has_errored() && !_stack.empty())
+        {
+            auto& top = _stack.back();
+            top.schema_pending = false;
+            if (top.value_schema && top.cur_field >= 0
+                && top.value_schema->fields[top.cur_field].kind
+                       == _ValueSchema::number)
+            {
+                top.numbers[top.value_schema->fields[top.cur_field].slot] =
+                    static_cast<double>(n);
+                top.fields_set |= 1u << top.cur_field;
+                top.cur_field = -1;
+                return true;
+            }
+        }
+        return store(std::any(n));
+    }
+
+    // Store a decoded value object, straight into a field of the enclosing
+    // value object if one is waiting for it.
+    bool store_field(std::any&& value)
+    {
+        if (!_stack.empty())
+        {
+            auto& top = _stack.back();
+            if (top.value_schema && top.cur_field >= 0)
+            {
+                auto const& field = top.value_schema->fields[top.cur_field];
+                if (field.kind == _ValueSchema::rational_time
+                    && _holds<RationalTime>(value))
+                {
+                    top.times[field.slot] = _get<RationalTime>(value);
+                }
+                else if (
+                    field.kind == _ValueSchema::point
+                    && _holds<IMATH_NAMESPACE::V2d>(value))
+                {
+                    top.points[field.slot] =
+                        _get<IMATH_NAMESPACE::V2d>(value);
+                }
+                else
+                {
+                    return store(std::move(value));
+                }
+                top.fields_set |= 1u << top.cur_field;
+                top.cur_field = -1;
+                return true;
+            }
+        }
+        return store(std::move(value));
+    }
+
     template <typename T>
     static T const* _lookup(AnyDictionary const& d, std::string const& key)
     {
@@ -233,7 +419,15 @@ public:
             string_printf(
                 "%s (near line %d)",
                 err_msg.c_str(),
-                _line_number_function()));
+                _line_number()));
+    }
+
+    // The current line, or -1 if lines are not being tracked.
+    int _line_number() const
+    {
+        return _line_number_function
+                   ? static_cast<int>(_line_number_function())
+                   : -1;
     }
 
     void _error(ErrorStatus const& error_status)
@@ -243,6 +437,270 @@ public:
 
     ErrorStatus _error_status;
 
+    // A value kept in a _ParseArena.  It is small enough for std::any to
+    // hold without allocating.
+    template <typename T>
+    struct _InArena
+    {
+        T const* value;
+    };
+
+    // Memory for values that only live until the object they were read for
+    // is built: the strings and time values of core object fields, and the
+    // values of value objects.  std::any would put each of them on the heap
+    // on its own.  Memory is taken in order, and handed back in bulk when
+    // an object ends; the blocks are then reused, so a document of any size
+    // needs only a few of them, which are freed with the decoder.
+    class _ParseArena
+    {
+    public:
+        struct Mark
+        {
+            size_t block = 0;
+            size_t used  = 0;
+        };
+
+        char* allocate(size_t size)
+        {
+            size = (size + _alignment - 1) & ~(_alignment - 1);
+            if (_block >= _blocks.size()
+                || _used + size > _blocks[_block].size)
+            {
+                // move on to the next block, or put in one large enough
+                if (_block < _blocks.size())
+                {
+                    ++_block;
+                }
+                _used = 0;
+                if (_block == _blocks.size() || _blocks[_block].size < size)
+                {
+                    _blocks.emplace(
+                        _blocks.begin() + _block,
+                        std::max(size, _block_size));
+                }
+            }
+
+            char* result = _blocks[_block].memory.get() + _used;
+            _used += size;
+            return result;
+        }
+
+        // Copy value into the arena.  T must be trivially destructible,
+        // since nothing in the arena is destroyed.
+        template <typename T>
+        std::any make(T const& value)
+        {
+            static_assert(std::is_trivially_destructible<T>::value, "");
+            return std::any(_InArena<T>{ new (allocate(sizeof(T))) T(value) });
+        }
+
+        Mark mark() const { return Mark{ _block, _used }; }
+
+        // Hand back everything taken since mark.
+        void rewind(Mark mark)
+        {
+            _block = mark.block;
+            _used  = mark.used;
+        }
+
+    private:
+        static constexpr size_t _alignment  = alignof(std::max_align_t);
+        static constexpr size_t _block_size = 64 * 1024;
+
+        struct _Block
+        {
+            explicit _Block(size_t size)
+                : memory(new char[size])
+                , size(size)
+            {}
+
+            std::unique_ptr<char[]> memory;
+            size_t                  size;
+        };
+
+        std::vector<_Block> _blocks;
+        size_t              _block = 0;
+        size_t              _used  = 0;
+    };
+
+    // The form a T takes in the arena: strings are kept as views of their
+    // characters.
+    template <typename T>
+    using _ArenaForm = _InArena<std::conditional_t<
+        std::is_same<T, std::string>::value,
+        std::string_view,
+        T>>;
+
+    // True if value holds a T, on the heap or in the arena.
+    template <typename T>
+    static bool _holds(std::any const& value)
+    {
+        return value.type() == typeid(T)
+               || value.type() == typeid(_ArenaForm<T>);
+    }
+
+    // The T value holds, given _holds<T>(value).
+    template <typename T>
+    static T _get(std::any const& value)
+    {
+        if (value.type() == typeid(_ArenaForm<T>))
+        {
+            return T(*std::any_cast<_ArenaForm<T>>(value).value);
+        }
+        return std::any_cast<T const&>(value);
+    }
+
+    template <typename T>
+    static bool _from_arena_as(std::any& value)
+    {
+        if (value.type() != typeid(_ArenaForm<T>))
+        {
+            return false;
+        }
+        value = _get<T>(value);
+        return true;
+    }
+
+    // Replace a value kept in the arena with one of its own, for storing
+    // anywhere that outlives the object being read.
+    static std::any& _from_arena(std::any& value)
+    {
+        _from_arena_as<std::string>(value)
+            || _from_arena_as<RationalTime>(value)
+            || _from_arena_as<TimeRange>(value)
+            || _from_arena_as<TimeTransform>(value)
+            || _from_arena_as<IMATH_NAMESPACE::V2d>(value)
+            || _from_arena_as<IMATH_NAMESPACE::Box2d>(value);
+        return value;
+    }
+
+    _ParseArena _arena;
+
+    struct _DictOrArray;
+
+    // A schema whose objects decode to plain values (RationalTime, TimeRange
+    // and so on).  Objects of these schemas are filled in field by field as
+    // the parser reports them, without building an AnyDictionary first.
+    struct _ValueSchema
+    {
+        enum FieldKind
+        {
+            number,
+            rational_time,
+            point
+        };
+
+        struct Field
+        {
+            char const* key;
+            FieldKind   kind;
+            int         slot;
+        };
+
+        char const* schema;
+        int         field_count;
+        Field       fields[3];
+
+        // Make the value in the arena; see _from_arena().
+        std::any (*make)(_DictOrArray const&, _ParseArena&);
+
+        static _ValueSchema const* find(char const* str, size_t length)
+        {
+            for (auto const& s: _all)
+            {
+                if (std::strlen(s.schema) == length
+                    && std::memcmp(s.schema, str, length) == 0)
+                {
+                    return &s;
+                }
+            }
+            return nullptr;
+        }
+
+        int field_index(char const* str, size_t length) const
+        {
+            for (int i = 0; i < field_count; i++)
+            {
+                if (std::strlen(fields[i].key) == length
+                    && std::memcmp(fields[i].key, str, length) == 0)
+                {
+                    return i;
+                }
+            }
+            return -1;
+        }
+
+        bool complete(_DictOrArray const& d) const
+        {
+            return d.fields_set == (1u << field_count) - 1;
+        }
+
+        static _ValueSchema const _all[5];
+    };
+
+    // A core schema at its current version.  No upgrade function applies
+    // to objects of these schemas, so they are built straight from the
+    // fields the parser reports, without an AnyDictionary or a Reader.  An
+    // object whose fields are not all the ones read_from() would read, of
+    // the types it expects, takes the general path instead.
+    struct _ObjectSchema
+    {
+        enum Field
+        {
+            name,
+            metadata,
+            source_range,
+            effects,
+            markers,
+            enabled,
+            children,
+            kind,
+            media_references,
+            active_media_reference_key,
+            available_range,
+            available_image_bounds,
+            target_url,
+            field_count
+        };
+
+        char const* schema;
+        unsigned    fields;   // the fields objects of the schema may have
+        unsigned    required; // the fields they must have
+
+        // Build the object, or return null without touching the fields if
+        // one of them is not of the expected type.
+        SerializableObject* (*make)(_DictOrArray&);
+
+        static _ObjectSchema const* find(char const* str, size_t length)
+        {
+            for (auto const& s: _all)
+            {
+                if (std::strlen(s.schema) == length
+                    && std::memcmp(s.schema, str, length) == 0)
+                {
+                    return &s;
+                }
+            }
+            return nullptr;
+        }
+
+        int field_index(char const* str, size_t length) const
+        {
+            for (int i = 0; i < field_count; i++)
+            {
+                if ((fields & (1u << i)) && std::strlen(keys[i]) == length
+                    && std::memcmp(keys[i], str, length) == 0)
+                {
+                    return i;
+                }
+            }
+            return -1;
+        }
+
+        static char const* const  keys[field_count];
+        static _ObjectSchema const _all[5];
+    };
+
     struct _DictOrArray
     {
         _DictOrArray(bool is_dict) { this->is_dict = is_dict; }
@@ -251,8 +709,414 @@ public:
         AnyDictionary dict;
         AnyVector     array;
         std::string   cur_key;
+
+        // The resolver's reference count when the object started.
+        size_t reference_count = 0;
+
+        // Where the arena stood when the object started.
+        _ParseArena::Mark arena_mark;
+
+        // Set while the first key of an object is OTIO_SCHEMA and its value
+        // has not been seen yet.
+        bool schema_pending = false;
+
+        // Set while the object is being decoded as a value schema; the
+        // fields are held in the slots below rather than in dict.
+        _ValueSchema const*  value_schema = nullptr;
+        int                  cur_field    = -1;
+        unsigned             fields_set   = 0;
+        double               numbers[2]   = {};
+        RationalTime         times[2];
+        IMATH_NAMESPACE::V2d points[2];
+
+        // Set while the object is being decoded as a core object schema;
+        // the fields are held in object_fields, using cur_field and
+        // fields_set as above.
+        _ObjectSchema const* object_schema = nullptr;
+        std::any             object_fields[_ObjectSchema::field_count];
     };
 
+    // Move the fields of a value or core object into its dictionary, so
+    // that decoding carries on along the general path.  This happens
+    // whenever the object holds something unexpected, so that the result
+    // (or the error reported) is the same as if the fast path had not been
+    // taken.
+    static void _demote(_DictOrArray& d)
+    {
+        _demote_value(d);
+        _demote_object(d);
+    }
+
+    static void _demote_value(_DictOrArray& d)
+    {
+        auto schema = d.value_schema;
+        if (!schema)
+        {
+            return;
+        }
+
+        d.value_schema = nullptr;
+        d.dict.emplace("OTIO_SCHEMA", std::string(schema->schema));
+        for (int i = 0; i < schema->field_count; i++)
+        {
+            auto const& field = schema->fields[i];
+            if (d.fields_set & (1u << i))
+            {
+                switch (field.kind)
+                {
+                    case _ValueSchema::number:
+                        d.dict.emplace(field.key, d.numbers[field.slot]);
+                        break;
+                    case _ValueSchema::rational_time:
+                        d.dict.emplace(field.key, d.times[field.slot]);
+                        break;
+                    case _ValueSchema::point:
+                        d.dict.emplace(field.key, d.points[field.slot]);
+                        break;
+                }
+            }
+        }
+        if (d.cur_field >= 0)
+        {
+            d.cur_key = schema->fields[d.cur_field].key;
+        }
+    }
+
+    static void _demote_object(_DictOrArray& d)
+    {
+        auto schema = d.object_schema;
+        if (!schema)
+        {
+            return;
+        }
+
+        d.object_schema = nullptr;
+        d.dict.emplace("OTIO_SCHEMA", std::string(schema->schema));
+        for (int i = 0; i < _ObjectSchema::field_count; i++)
+        {
+            if (d.fields_set & (1u << i))
+            {
+                d.dict.emplace(
+                    _ObjectSchema::keys[i],
+                    std::move(_from_arena(d.object_fields[i])));
+            }
+        }
+        if (d.cur_field >= 0)
+        {
+            d.cur_key = _ObjectSchema::keys[d.cur_field];
+        }
+    }
+
+    // A value object holds only numbers and nested value objects, so
+    // anything else stored into it sends it down the general path.  The
+    // fields of a core object may be of any kind, and are checked when the
+    // object ends.
+    void _demote_top()
+    {
+        if (!_stack.empty())
+        {
+            _stack.back().schema_pending = false;
+            _demote_value(_stack.back());
+        }
+    }
+
+    // Build the core object d describes, or return null if it is missing a
+    // field, holds a field of the wrong type, or holds references, which
+    // only the general path resolves.
+    SerializableObject* _make_object(_DictOrArray& d) const
+    {
+        auto schema = d.object_schema;
+        return schema && _resolver.reference_count == d.reference_count
+                       && (d.fields_set & schema->required) == schema->required
+                   ? schema->make(d)
+                   : nullptr;
+    }
+
+    static bool _given(_DictOrArray const& d, int field)
+    {
+        return d.fields_set & (1u << field);
+    }
+
+    // True if the field was not given, or holds a T.
+    template <typename T>
+    static bool _absent_or(_DictOrArray const& d, int field)
+    {
+        return !_given(d, field) || _holds<T>(d.object_fields[field]);
+    }
+
+    // As above, but also true if the field is null, which read_from() takes
+    // as the empty string, or as no value.
+    template <typename T>
+    static bool _absent_null_or(_DictOrArray const& d, int field)
+    {
+        return !d.object_fields[field].has_value()
+               || _holds<T>(d.object_fields[field]);
+    }
+
+    // The T the decoded value refers to, or null if it is not a T object.
+    template <typename T>
+    static T* _object(std::any const& value)
+    {
+        return value.type() == typeid(SerializableObject::Retainer<>)
+                   ? dynamic_cast<T*>(
+                         std::any_cast<SerializableObject::Retainer<> const&>(
+                             value)
+                             .value)
+                   : nullptr;
+    }
+
+    // True if the field was not given, or is an array of T objects.
+    template <typename T>
+    static bool _absent_or_objects(_DictOrArray const& d, int field)
+    {
+        if (!_absent_or<AnyVector>(d, field))
+        {
+            return false;
+        }
+        if (_given(d, field))
+        {
+            for (auto const& e:
+                 std::any_cast<AnyVector const&>(d.object_fields[field]))
+            {
+                if (!_object<T>(e))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    template <typename T>
+    static void _take_objects(
+        _DictOrArray const&                           d,
+        int                                           field,
+        std::vector<SerializableObject::Retainer<T>>* dest)
+    {
+        if (_given(d, field))
+        {
+            auto const& objects =
+                std::any_cast<AnyVector const&>(d.object_fields[field]);
+            dest->clear();
+            dest->reserve(objects.size());
+            for (auto const& e: objects)
+            {
+                dest->emplace_back(_object<T>(e));
+            }
+        }
+    }
+
+    template <typename T>
+    static void
+    _take_optional(_DictOrArray const& d, int field, std::optional<T>* dest)
+    {
+        if (_given(d, field))
+        {
+            auto const& value = d.object_fields[field];
+            *dest = value.has_value() ? std::optional<T>(_get<T>(value))
+                                      : std::nullopt;
+        }
+    }
+
+    // The string a given string field holds, empty if it is null.
+    static std::string _take_string(_DictOrArray& d, int field)
+    {
+        auto const& value = d.object_fields[field];
+        return value.has_value() ? _get<std::string>(value) : std::string();
+    }
+
+    static bool _check_with_metadata(_DictOrArray const& d)
+    {
+        return _absent_null_or<std::string>(d, _ObjectSchema::name)
+               && _absent_or<AnyDictionary>(d, _ObjectSchema::metadata);
+    }
+
+    static void
+    _fill_with_metadata(SerializableObjectWithMetadata* so, _DictOrArray& d)
+    {
+        if (_given(d, _ObjectSchema::metadata))
+        {
+            auto& metadata = std::any_cast<AnyDictionary&>(
+                d.object_fields[_ObjectSchema::metadata]);
+            if (!metadata.empty())
+            {
+                so->_mutable_metadata().swap(metadata);
+            }
+        }
+        if (_given(d, _ObjectSchema::name))
+        {
+            so->_name =
+                InternedString::decoded(_take_string(d, _ObjectSchema::name));
+        }
+    }
+
+    static bool _check_item(_DictOrArray const& d)
+    {
+        return _check_with_metadata(d)
+               && _absent_null_or<TimeRange>(d, _ObjectSchema::source_range)
+               && _absent_or_objects<Effect>(d, _ObjectSchema::effects)
+               && _absent_or_objects<Marker>(d, _ObjectSchema::markers)
+               && _absent_or<bool>(d, _ObjectSchema::enabled);
+    }
+
+    static void _fill_item(Item* item, _DictOrArray& d)
+    {
+        _fill_with_metadata(item, d);
+        _take_optional(d, _ObjectSchema::source_range, &item->_source_range);
+        _take_objects(d, _ObjectSchema::effects, &item->_effects);
+        item->_hold_effects();
+        _take_objects(d, _ObjectSchema::markers, &item->_markers);
+        if (_given(d, _ObjectSchema::enabled))
+        {
+            item->_enabled =
+                std::any_cast<bool>(d.object_fields[_ObjectSchema::enabled]);
+        }
+    }
+
+    // Every child of a newly decoded composition is itself newly decoded,
+    // so none should have a parent yet; a document can only share a child
+    // between compositions through references, which take the general path.
+    static bool _check_composition(_DictOrArray const& d)
+    {
+        return _check_item(d)
+               && _absent_or_objects<Composable>(d, _ObjectSchema::children);
+    }
+
+    // Return false if a child already has a parent.  The children are
+    // adopted before anything is moved out of d, so that on failure d can
+    // still take the general path, which reports CHILD_ALREADY_PARENTED.
+    static bool _fill_composition(Composition* composition, _DictOrArray& d)
+    {
+        _take_objects(d, _ObjectSchema::children, &composition->_children);
+        if (!composition->_adopt_children())
+        {
+            return false;
+        }
+        _fill_item(composition, d);
+        return true;
+    }
+
+    static bool _check_media_reference(_DictOrArray const& d)
+    {
+        return _check_with_metadata(d)
+               && _absent_null_or<TimeRange>(d, _ObjectSchema::available_range)
+               && _absent_null_or<IMATH_NAMESPACE::Box2d>(
+                   d,
+                   _ObjectSchema::available_image_bounds);
+    }
+
+    static void
+    _fill_media_reference(MediaReference* media_reference, _DictOrArray& d)
+    {
+        _fill_with_metadata(media_reference, d);
+        _take_optional(
+            d,
+            _ObjectSchema::available_range,
+            &media_reference->_available_range);
+        _take_optional(
+            d,
+            _ObjectSchema::available_image_bounds,
+            &media_reference->_available_image_bounds);
+    }
+
+    static SerializableObject* _make_clip(_DictOrArray& d)
+    {
+        auto const& media_references =
+            d.object_fields[_ObjectSchema::media_references];
+        if (!_check_item(d)
+            || !_absent_or<AnyDictionary>(d, _ObjectSchema::media_references)
+            || !_absent_null_or<std::string>(
+                d,
+                _ObjectSchema::active_media_reference_key))
+        {
+            return nullptr;
+        }
+        for (auto const& e:
+             std::any_cast<AnyDictionary const&>(media_references))
+        {
+            if (!_object<MediaReference>(e.second))
+            {
+                return nullptr;
+            }
+        }
+
+        auto clip = new Clip;
+        _fill_item(clip, d);
+        clip->_media_references.clear();
+        for (auto const& e:
+             std::any_cast<AnyDictionary const&>(media_references))
+        {
+            clip->_media_references.emplace(
+                e.first,
+                _object<MediaReference>(e.second));
+        }
+        clip->_hold_media_references();
+        clip->_active_media_reference_key =
+            _take_string(d, _ObjectSchema::active_media_reference_key);
+        return clip;
+    }
+
+    static SerializableObject* _make_gap(_DictOrArray& d)
+    {
+        if (!_check_item(d))
+        {
+            return nullptr;
+        }
+
+        auto gap = new Gap;
+        _fill_item(gap, d);
+        return gap;
+    }
+
+    static SerializableObject* _make_track(_DictOrArray& d)
+    {
+        if (!_check_composition(d)
+            || !_absent_null_or<std::string>(d, _ObjectSchema::kind))
+        {
+            return nullptr;
+        }
+
+        auto track = new Track;
+        if (!_fill_composition(track, d))
+        {
+            track->possibly_delete();
+            return nullptr;
+        }
+        track->_kind = _take_string(d, _ObjectSchema::kind);
+        return track;
+    }
+
+    static SerializableObject* _make_stack(_DictOrArray& d)
+    {
+        if (!_check_composition(d))
+        {
+            return nullptr;
+        }
+
+        auto stack = new Stack;
+        if (!_fill_composition(stack, d))
+        {
+            stack->possibly_delete();
+            return nullptr;
+        }
+        return stack;
+    }
+
+    static SerializableObject* _make_external_reference(_DictOrArray& d)
+    {
+        if (!_check_media_reference(d)
+            || !_absent_null_or<std::string>(d, _ObjectSchema::target_url))
+        {
+            return nullptr;
+        }
+
+        auto reference = new ExternalReference;
+        _fill_media_reference(reference, d);
+        reference->_target_url =
+            InternedString::decoded(_take_string(d, _ObjectSchema::target_url));
+        return reference;
+    }
+
     std::vector<_DictOrArray>               _stack;
     std::function<void(ErrorStatus const&)> _error_function;
     std::function<size_t()>                 _line_number_function;
@@ -260,6 +1124,101 @@ public:
     SerializableObject::Reader::_Resolver _resolver;
 };
 
+JSONDecoder::_ValueSchema const JSONDecoder::_ValueSchema::_all[5] = {
+    { "RationalTime.1",
+      2,
+      { { "rate", number, 0 }, { "value", number, 1 } },
+      [](_DictOrArray const& d, _ParseArena& arena) {
+          return arena.make(RationalTime(d.numbers[1], d.numbers[0]));
+      } },
+    { "TimeRange.1",
+      2,
+      { { "start_time", rational_time, 0 }, { "duration", rational_time, 1 } },
+      [](_DictOrArray const& d, _ParseArena& arena) {
+          return arena.make(TimeRange(d.times[0], d.times[1]));
+      } },
+    { "TimeTransform.1",
+      3,
+      { { "offset", rational_time, 0 },
+        { "rate", number, 0 },
+        { "scale", number, 1 } },
+      [](_DictOrArray const& d, _ParseArena& arena) {
+          return arena.make(
+              TimeTransform(d.times[0], d.numbers[1], d.numbers[0]));
+      } },
+    { "V2d.1",
+      2,
+      { { "x", number, 0 }, { "y", number, 1 } },
+      [](_DictOrArray const& d, _ParseArena& arena) {
+          return arena.make(IMATH_NAMESPACE::V2d(d.numbers[0], d.numbers[1]));
+      } },
+    { "Box2d.1",
+      2,
+      { { "min", point, 0 }, { "max", point, 1 } },
+      [](_DictOrArray const& d, _ParseArena& arena) {
+          return arena.make(IMATH_NAMESPACE::Box2d(d.points[0], d.points[1]));
+      } },
+};
+
+char const* const JSONDecoder::_ObjectSchema::keys[field_count] = {
+    "name",
+    "metadata",
+    "source_range",
+    "effects",
+    "markers",
+    "enabled",
+    "children",
+    "kind",
+    "media_references",
+    "active_media_reference_key",
+    "available_range",
+    "available_image_bounds",
+    "target_url",
+};
+
+// The schema strings below name the current versions.
+static_assert(Clip::Schema::version == 2, "Clip schema version changed");
+static_assert(Gap::Schema::version == 1, "Gap schema version changed");
+static_assert(Track::Schema::version == 1, "Track schema version changed");
+static_assert(Stack::Schema::version == 1, "Stack schema version changed");
+static_assert(
+    ExternalReference::Schema::version == 1,
+    "ExternalReference schema version changed");
+
+namespace {
+
+using _F = JSONDecoder::_ObjectSchema;
+
+unsigned constexpr _with_metadata_fields = 1u << _F::name | 1u << _F::metadata;
+unsigned constexpr _item_fields =
+    _with_metadata_fields | 1u << _F::source_range | 1u << _F::effects
+    | 1u << _F::markers | 1u << _F::enabled;
+unsigned constexpr _media_reference_fields =
+    _with_metadata_fields | 1u << _F::available_range
+    | 1u << _F::available_image_bounds;
+
+} // namespace
+
+JSONDecoder::_ObjectSchema const JSONDecoder::_ObjectSchema::_all[5] = {
+    { "Clip.2",
+      _item_fields | 1u << media_references | 1u << active_media_reference_key,
+      1u << media_references | 1u << active_media_reference_key,
+      &JSONDecoder::_make_clip },
+    { "Gap.1", _item_fields, 0, &JSONDecoder::_make_gap },
+    { "Track.1",
+      _item_fields | 1u << children | 1u << kind,
+      1u << children | 1u << kind,
+      &JSONDecoder::_make_track },
+    { "Stack.1",
+      _item_fields | 1u << children,
+      1u << children,
+      &JSONDecoder::_make_stack },
+    { "ExternalReference.1",
+      _media_reference_fields | 1u << target_url,
+      1u << target_url,
+      &JSONDecoder::_make_external_reference },
+};
+
 SerializableObject::Reader::Reader(
     AnyDictionary&          source,
     error_function_t const& error_function,
@@ -323,7 +1282,7 @@ SerializableObject::Reader::_fix_reference_ids(
     _Resolver&              resolver,
     int                     line_number)
 {
-    for (auto& e: m)
+    for (auto&& e: m)
     {
         _fix_reference_ids(e.second, error_function, resolver, line_number);
     }
@@ -336,40 +1295,48 @@ SerializableObject::Reader::_fix_reference_ids(
     _Resolver&              resolver,
     int                     line_number)
 {
-    if (a.type() == typeid(AnyDictionary))
+    switch (safely_typed_any_kind(a))
     {
-        _fix_reference_ids(
-            std::any_cast<AnyDictionary&>(a),
-            error_function,
-            resolver,
-            line_number);
-    }
-    else if (a.type() == typeid(AnyVector))
-    {
-        AnyVector& child_array = std::any_cast<AnyVector&>(a);
-        for (size_t i = 0; i < child_array.size(); i++)
-        {
+        case AnyKind::dictionary_value:
             _fix_reference_ids(
-                child_array[i],
+                std::any_cast<AnyDictionary&>(a),
                 error_function,
                 resolver,
                 line_number);
+            break;
+        case AnyKind::vector_value: {
+            AnyVector& child_array = std::any_cast<AnyVector&>(a);
+            for (size_t i = 0; i < child_array.size(); i++)
+            {
+                _fix_reference_ids(
+                    child_array[i],
+                    error_function,
+                    resolver,
+                    line_number);
+            }
+            break;
         }
-    }
-    else if (a.type() == typeid(SerializableObject::ReferenceId))
-    {
-        std::string id = std::any_cast<SerializableObject::ReferenceId>(a).id;
-        auto        e  = resolver.object_for_id.find(id);
-        if (e == resolver.object_for_id.end())
-        {
-            error_function(ErrorStatus(
-                ErrorStatus::UNRESOLVED_OBJECT_REFERENCE,
-                string_printf("%s (near line %d)", id.c_str(), line_number)));
-        }
-        else
-        {
-            a = std::any(Retainer<>(e->second));
+        case AnyKind::reference_id_value: {
+            std::string id =
+                std::any_cast<SerializableObject::ReferenceId>(a).id;
+            auto e = resolver.object_for_id.find(id);
+            if (e == resolver.object_for_id.end())
+            {
+                error_function(ErrorStatus(
+                    ErrorStatus::UNRESOLVED_OBJECT_REFERENCE,
+                    string_printf(
+                        "%s (near line %d)",
+                        id.c_str(),
+                        line_number)));
+            }
+            else
+            {
+                a = std::any(Retainer<>(e->second));
+            }
+            break;
         }
+        default:
+            break;
     }
 }
 
@@ -424,23 +1391,22 @@ SerializableObject::Reader::_fetch(std::string const& key, double* dest)
         return false;
     }
 
-    if (e->second.type() == typeid(double))
+    switch (safely_typed_any_kind(e->second))
     {
-        *dest = std::any_cast<double>(e->second);
-        _dict.erase(e);
-        return true;
-    }
-    else if (e->second.type() == typeid(int))
-    {
-        *dest = static_cast<double>(std::any_cast<int>(e->second));
-        _dict.erase(e);
-        return true;
-    }
-    else if (e->second.type() == typeid(int64_t))
-    {
-        *dest = static_cast<double>(std::any_cast<int64_t>(e->second));
-        _dict.erase(e);
-        return true;
+        case AnyKind::double_value:
+            *dest = std::any_cast<double>(e->second);
+            _dict.erase(e);
+            return true;
+        case AnyKind::int_value:
+            *dest = static_cast<double>(std::any_cast<int>(e->second));
+            _dict.erase(e);
+            return true;
+        case AnyKind::int64_value:
+            *dest = static_cast<double>(std::any_cast<int64_t>(e->second));
+            _dict.erase(e);
+            return true;
+        default:
+            break;
     }
 
     _error(ErrorStatus(
@@ -463,17 +1429,18 @@ SerializableObject::Reader::_fetch(std::string const& key, int64_t* dest)
         return false;
     }
 
-    if (e->second.type() == typeid(int64_t))
+    switch (safely_typed_any_kind(e->second))
     {
-        *dest = std::any_cast<int64_t>(e->second);
-        _dict.erase(e);
-        return true;
-    }
-    else if (e->second.type() == typeid(int))
-    {
-        *dest = std::any_cast<int>(e->second);
-        _dict.erase(e);
-        return true;
+        case AnyKind::int64_value:
+            *dest = std::any_cast<int64_t>(e->second);
+            _dict.erase(e);
+            return true;
+        case AnyKind::int_value:
+            *dest = std::any_cast<int>(e->second);
+            _dict.erase(e);
+            return true;
+        default:
+            break;
     }
 
     _error(ErrorStatus(
@@ -558,7 +1525,7 @@ SerializableObject::Reader::_type_check_so(
 }
 
 std::any
-SerializableObject::Reader::_decode(_Resolver& resolver)
+SerializableObject::Reader::_decode(_Resolver& resolver, bool has_references)
 {
     if (_dict.find("OTIO_SCHEMA") == _dict.end())
     {
@@ -604,6 +1571,7 @@ SerializableObject::Reader::_decode(_Resolver& resolver)
             return std::any();
         }
 
+        resolver.reference_count++;
         return std::any(SerializableObject::ReferenceId{ ref_id });
     }
     else if (schema_name_and_version == "V2d.1")
@@ -670,6 +1638,17 @@ SerializableObject::Reader::_decode(_Resolver& resolver)
             {
                 resolver.object_for_id[ref_id] = so;
             }
+
+            // without references there is nothing to wait for, and reading
+            // the object now frees its dictionary straight away
+            if (!has_references)
+            {
+                Retainer<> result(so);
+                Reader     r(_dict, _error_function, so, _line_number);
+                so->read_from(r);
+                return std::any(std::move(result));
+            }
+
             resolver.data_for_object.emplace(so, std::move(_dict));
             resolver.line_number_for_object[so] = _line_number;
             return std::any(SerializableObject::Retainer<>(so));
@@ -714,6 +1693,19 @@ SerializableObject::Reader::read(std::string const& key, std::string* value)
     return true;
 }
 
+bool
+SerializableObject::Reader::read(std::string const& key, InternedString* value)
+{
+    std::string s;
+    if (!read(key, &s))
+    {
+        return false;
+    }
+
+    *value = InternedString::decoded(std::move(s));
+    return true;
+}
+
 bool
 SerializableObject::Reader::read(std::string const& key, RationalTime* value)
 {
@@ -849,19 +1841,38 @@ SerializableObject::Reader::read(std::string const& key, std::any* value)
     }
 }
 
-bool
-deserialize_json_from_string(
-    std::string const& input,
-    std::any*          destination,
-    ErrorStatus*       error_status)
+// Parse the stream into destination.  Tracking lines costs time on every
+// character and is only needed to say where an error is, so callers parse
+// without it first and only parse again with it if that fails.
+template <unsigned parse_flags, typename Stream>
+static bool
+_parse_json(
+    Stream&      stream,
+    bool         track_lines,
+    std::any*    destination,
+    ErrorStatus* error_status)
 {
-    OTIO_rapidjson::Reader                            reader;
-    OTIO_rapidjson::StringStream                      ss(input.c_str());
-    OTIO_rapidjson::CursorStreamWrapper<decltype(ss)> csw(ss);
+    OTIO_rapidjson::Reader reader;
+
+    if (!track_lines)
+    {
+        JSONDecoder handler(nullptr);
+        bool        status = reader.Parse<parse_flags>(stream, handler);
+        handler.finalize();
+
+        if (!status || handler.has_errored(error_status))
+        {
+            return false;
+        }
+
+        destination->swap(handler._root);
+        return true;
+    }
+
+    OTIO_rapidjson::CursorStreamWrapper<Stream> csw(stream);
     JSONDecoder handler(std::bind(&decltype(csw)::GetLine, &csw));
 
-    bool status =
-        reader.Parse<OTIO_rapidjson::kParseNanAndInfFlag>(csw, handler);
+    bool status = reader.Parse<parse_flags>(csw, handler);
     handler.finalize();
 
     if (handler.has_errored(error_status))
@@ -891,72 +1902,265 @@ deserialize_json_from_string(
 }
 
 bool
-deserialize_json_from_file(
-    std::string const& file_name,
+deserialize_json_from_string(
+    std::string const& input,
     std::any*          destination,
     ErrorStatus*       error_status)
 {
+    OTIO_rapidjson::StringStream ss(input.c_str());
+    if (_parse_json<OTIO_rapidjson::kParseNanAndInfFlag>(
+            ss,
+            false,
+            destination,
+            error_status))
+    {
+        return true;
+    }
 
-    FILE* fp = nullptr;
-#if defined(_WINDOWS)
-    const int wlen =
-        MultiByteToWideChar(CP_UTF8, 0, file_name.c_str(), -1, NULL, 0);
-    std::vector<wchar_t> wchars(wlen);
-    MultiByteToWideChar(CP_UTF8, 0, file_name.c_str(), -1, wchars.data(), wlen);
-    if (_wfopen_s(&fp, wchars.data(), L"r") != 0)
+    OTIO_rapidjson::StringStream tracked(input.c_str());
+    return _parse_json<OTIO_rapidjson::kParseNanAndInfFlag>(
+        tracked,
+        true,
+        destination,
+        error_status);
+}
+
+// The contents of a JSON file, held in memory so that they can be parsed in
+// place.  Where possible the file is mapped rather than read, and the part
+// the parser has finished with is handed back to the system as it goes, so
+// a large file is never resident all at once.
+class InSituFile
+{
+public:
+    InSituFile() = default;
+
+    InSituFile(InSituFile const&)            = delete;
+    InSituFile& operator=(InSituFile const&) = delete;
+
+    ~InSituFile()
     {
-        fp = nullptr;
+#if !defined(_WINDOWS)
+        if (_mapped)
+        {
+            munmap(_data, _size);
+        }
+#endif // _WINDOWS
     }
+
+    bool open(std::string const& file_name)
+    {
+#if defined(_WINDOWS)
+        const int wlen =
+            MultiByteToWideChar(CP_UTF8, 0, file_name.c_str(), -1, NULL, 0);
+        std::vector<wchar_t> wchars(wlen);
+        MultiByteToWideChar(
+            CP_UTF8,
+            0,
+            file_name.c_str(),
+            -1,
+            wchars.data(),
+            wlen);
+        FILE* fp = nullptr;
+        if (_wfopen_s(&fp, wchars.data(), L"rb") != 0)
+        {
+            return false;
+        }
+        const bool status = _read(fp);
+        fclose(fp);
+        return status;
 #else  // _WINDOWS
-    fp = fopen(file_name.c_str(), "r");
+        const int fd = ::open(file_name.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            return false;
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0)
+        {
+            // a private, writable mapping lets the parser unescape strings
+            // in place without touching the file
+            void* data = mmap(
+                nullptr,
+                st.st_size,
+                PROT_READ | PROT_WRITE,
+                MAP_PRIVATE,
+                fd,
+                0);
+            if (data != MAP_FAILED)
+            {
+                close(fd);
+                madvise(data, st.st_size, MADV_SEQUENTIAL);
+                _data   = static_cast<char*>(data);
+                _size   = st.st_size;
+                _mapped = true;
+                return true;
+            }
+        }
+
+        // pipes, empty files and anything that cannot be mapped are read
+        FILE* fp = fdopen(fd, "rb");
+        if (!fp)
+        {
+            close(fd);
+            return false;
+        }
+        const bool status = _read(fp);
+        fclose(fp);
+        return status;
 #endif // _WINDOWS
-    if (!fp)
+    }
+
+    char* begin() const { return _data; }
+    char* end() const { return _data + _size; }
+
+    // Hand back the pages before the given position, which the parser must
+    // never look at again.
+    void release(char const* position)
     {
-        if (error_status)
+#if !defined(_WINDOWS)
+        if (!_mapped)
         {
-            *error_status =
-                ErrorStatus(ErrorStatus::FILE_OPEN_FAILED, file_name);
+            return;
         }
-        return false;
+
+        static const size_t page_size = sysconf(_SC_PAGESIZE);
+        const size_t        offset    = position - _data;
+        const size_t        up_to     = offset - offset % page_size;
+        if (up_to > _released)
+        {
+            madvise(_data + _released, up_to - _released, MADV_DONTNEED);
+            _released = up_to;
+        }
+#else  // _WINDOWS
+        (void) position;
+#endif // _WINDOWS
     }
 
-    OTIO_rapidjson::Reader reader;
+private:
+    bool _read(FILE* fp)
+    {
+        char   chunk[65536];
+        size_t count;
+        while ((count = fread(chunk, 1, sizeof(chunk), fp)) > 0)
+        {
+            _buffer.insert(_buffer.end(), chunk, chunk + count);
+        }
+        if (ferror(fp))
+        {
+            return false;
+        }
+        _data = _buffer.data();
+        _size = _buffer.size();
+        return true;
+    }
 
-    char                           readBuffer[65536];
-    OTIO_rapidjson::FileReadStream fs(fp, readBuffer, sizeof(readBuffer));
-    OTIO_rapidjson::CursorStreamWrapper<decltype(fs)> csw(fs);
-    JSONDecoder handler(std::bind(&decltype(csw)::GetLine, &csw));
+    char*             _data     = nullptr;
+    size_t            _size     = 0;
+    size_t            _released = 0;
+    bool              _mapped   = false;
+    std::vector<char> _buffer;
+};
 
-    bool status =
-        reader.Parse<OTIO_rapidjson::kParseNanAndInfFlag>(csw, handler);
-    fclose(fp);
+// A rapidjson stream for in-situ parsing of an InSituFile.  Strings are
+// unescaped where they lie, so the decoder reads each one straight from the
+// file's memory.
+class InSituStream
+{
+public:
+    typedef char Ch;
 
-    handler.finalize();
+    InSituStream(InSituFile& file)
+        : _file(file)
+        , _begin(file.begin())
+        , _src(file.begin())
+        , _end(file.end())
+        , _dst(nullptr)
+        , _string(nullptr)
+    {}
 
-    if (handler.has_errored(error_status))
+    Ch Peek() const { return _src != _end ? *_src : '\0'; }
+
+    Ch Take()
     {
-        return false;
+        if (Tell() >= _release_offset)
+        {
+            _release();
+        }
+        return _src != _end ? *_src++ : '\0';
     }
 
-    if (!status)
+    size_t Tell() const { return static_cast<size_t>(_src - _begin); }
+
+    Ch* PutBegin() { return _string = _dst = _src; }
+
+    void Put(Ch c) { *_dst++ = c; }
+
+    size_t PutEnd(Ch* begin)
     {
-        auto msg = GetParseError_En(reader.GetParseErrorCode());
-        if (error_status)
+        // the decoder is handed the string before anything more is taken,
+        // so once the next character is taken the string is no longer needed
+        _string = nullptr;
+        return static_cast<size_t>(_dst - begin);
+    }
+
+private:
+    static constexpr size_t _release_interval = 16 * 1024 * 1024;
+
+    void _release()
+    {
+        // keep a string that is still being parsed
+        _file.release(_string ? _string : _src);
+        _release_offset = Tell() + _release_interval;
+    }
+
+    InSituFile& _file;
+    char*       _begin;
+    char*       _src;
+    char*       _end;
+    char*       _dst;
+    char*       _string;
+
+    // an offset rather than a pointer, since the file may be smaller than
+    // the interval, or empty with a null begin()
+    size_t _release_offset = _release_interval;
+};
+
+bool
+deserialize_json_from_file(
+    std::string const& file_name,
+    std::any*          destination,
+    ErrorStatus*       error_status)
+{
+    constexpr unsigned parse_flags = OTIO_rapidjson::kParseInsituFlag
+                                     | OTIO_rapidjson::kParseNanAndInfFlag;
+
+    // parsing in place changes the file's contents in memory, so a second
+    // parse to find where an error is has to start from a fresh copy
+    for (bool track_lines: { false, true })
+    {
+        InSituFile file;
+        if (!file.open(file_name))
         {
-            *error_status = ErrorStatus(
-                ErrorStatus::JSON_PARSE_ERROR,
-                string_printf(
-                    "JSON parse error on input string: %s "
-                    "(line %d, column %d)",
-                    msg,
-                    csw.GetLine(),
-                    csw.GetColumn()));
+            if (error_status)
+            {
+                *error_status =
+                    ErrorStatus(ErrorStatus::FILE_OPEN_FAILED, file_name);
+            }
+            return false;
         }
-        return false;
-    }
 
-    destination->swap(handler._root);
-    return true;
+        InSituStream iss(file);
+        if (_parse_json<parse_flags>(
+                iss,
+                track_lines,
+                destination,
+                error_status))
+        {
+            return true;
+        }
+    }
+    return false;
 }
 
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
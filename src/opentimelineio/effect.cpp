@@ -2,6 +2,7 @@
 // Copyright Contributors to the OpenTimelineIO project
 
 #include "opentimelineio/effect.h"
+#include "opentimelineio/composable.h"
 #include "opentimelineio/missingReference.h"
 
 namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
@@ -19,6 +20,18 @@ Effect::Effect(
 Effect::~Effect()
 {}
 
+void
+Effect::_effect_changed() noexcept
+{
+    content_changed();
+    _for_each_holder([](SerializableObject* holder) {
+        if (auto composable = dynamic_cast<Composable*>(holder))
+        {
+            composable->mark_modified();
+        }
+    });
+}
+
 bool
 Effect::read_from(Reader& reader)
 {
@@ -35,4 +48,28 @@ Effect::write_to(Writer& writer) const
     writer.write("enabled", _enabled);
 }
 
+std::type_info const&
+Effect::_direct_class() const
+{
+    return typeid(Effect);
+}
+
+bool
+Effect::_copy_to(SerializableObject* clone, Cloner& cloner) const
+{
+    auto c          = static_cast<Effect*>(clone);
+    c->_effect_name = _effect_name;
+    c->_enabled     = _enabled;
+    return Parent::_copy_to(clone, cloner);
+}
+
+bool
+Effect::_equals(SerializableObject const& other, Comparer& comparer) const
+{
+    auto const& o = static_cast<Effect const&>(other);
+    return _effect_name == o._effect_name
+           && _enabled == o._enabled
+           && Parent::_equals(other, comparer);
+}
+
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
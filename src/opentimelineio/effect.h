@@ -30,18 +30,31 @@ public:
     void set_effect_name(std::string const& effect_name)
     {
         _effect_name = effect_name;
+        _effect_changed();
     }
 
     bool enabled() const { return _enabled; };
 
-    void set_enabled(bool enabled) { _enabled = enabled; }  
+    void set_enabled(bool enabled)
+    {
+        _enabled = enabled;
+        _effect_changed();
+    }
 
 protected:
     virtual ~Effect();
 
+    // Bump the modification stamps of the items holding this effect.
+    // Subclasses call this from their setters.
+    void _effect_changed() noexcept;
+
     bool read_from(Reader&) override;
     void write_to(Writer&) const override;
 
+    std::type_info const& _direct_class() const override;
+    bool _copy_to(SerializableObject* clone, Cloner&) const override;
+    bool _equals(SerializableObject const& other, Comparer&) const override;
+
 private:
     std::string _effect_name;
     bool        _enabled;
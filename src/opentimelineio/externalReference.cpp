@@ -30,4 +30,27 @@ ExternalReference::write_to(Writer& writer) const
     writer.write("target_url", _target_url);
 }
 
+std::type_info const&
+ExternalReference::_direct_class() const
+{
+    return typeid(ExternalReference);
+}
+
+bool
+ExternalReference::_copy_to(SerializableObject* clone, Cloner& cloner) const
+{
+    static_cast<ExternalReference*>(clone)->_target_url = _target_url;
+    return Parent::_copy_to(clone, cloner);
+}
+
+bool
+ExternalReference::_equals(
+    SerializableObject const& other,
+    Comparer&                 comparer) const
+{
+    auto const& o = static_cast<ExternalReference const&>(other);
+    return _target_url == o._target_url
+           && Parent::_equals(other, comparer);
+}
+
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
@@ -31,6 +31,7 @@ public:
     void set_target_url(std::string const& target_url)
     {
         _target_url = target_url;
+        content_changed();
     }
 
 protected:
@@ -39,8 +40,14 @@ protected:
     bool read_from(Reader&) override;
     void write_to(Writer&) const override;
 
+    std::type_info const& _direct_class() const override;
+    bool _copy_to(SerializableObject* clone, Cloner&) const override;
+    bool _equals(SerializableObject const& other, Comparer&) const override;
+
 private:
-    std::string _target_url;
+    InternedString _target_url;
+
+    friend class JSONDecoder;
 };
 
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
@@ -12,4 +12,10 @@ FreezeFrame::FreezeFrame(std::string const& name, AnyDictionary const& metadata)
 FreezeFrame::~FreezeFrame()
 {}
 
+std::type_info const&
+FreezeFrame::_direct_class() const
+{
+    return typeid(FreezeFrame);
+}
+
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
@@ -25,6 +25,8 @@ public:
 
 protected:
     virtual ~FreezeFrame();
+
+    std::type_info const& _direct_class() const override;
 };
 
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
@@ -49,4 +49,10 @@ Gap::write_to(Writer& writer) const
     Parent::write_to(writer);
 }
 
+std::type_info const&
+Gap::_direct_class() const
+{
+    return typeid(Gap);
+}
+
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
@@ -39,6 +39,8 @@ protected:
 
     bool read_from(Reader&) override;
     void write_to(Writer&) const override;
+
+    std::type_info const& _direct_class() const override;
 };
 
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
@@ -36,4 +36,30 @@ GeneratorReference::write_to(Writer& writer) const
     writer.write("parameters", _parameters);
 }
 
+std::type_info const&
+GeneratorReference::_direct_class() const
+{
+    return typeid(GeneratorReference);
+}
+
+bool
+GeneratorReference::_copy_to(SerializableObject* clone, Cloner& cloner) const
+{
+    auto c             = static_cast<GeneratorReference*>(clone);
+    c->_generator_kind = _generator_kind;
+    return cloner.copy(_parameters, &c->_parameters)
+           && Parent::_copy_to(clone, cloner);
+}
+
+bool
+GeneratorReference::_equals(
+    SerializableObject const& other,
+    Comparer&                 comparer) const
+{
+    auto const& o = static_cast<GeneratorReference const&>(other);
+    return _generator_kind == o._generator_kind
+           && Parent::_equals(other, comparer)
+           && comparer.equal(_parameters, o._parameters);
+}
+
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
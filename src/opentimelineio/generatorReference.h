@@ -33,9 +33,14 @@ public:
     void set_generator_kind(std::string const& generator_kind)
     {
         _generator_kind = generator_kind;
+        content_changed();
     }
 
-    AnyDictionary& parameters() noexcept { return _parameters; }
+    AnyDictionary& parameters() noexcept
+    {
+        content_changed();
+        return _parameters;
+    }
 
     AnyDictionary parameters() const noexcept { return _parameters; }
 
@@ -45,6 +50,10 @@ protected:
     bool read_from(Reader&) override;
     void write_to(Writer&) const override;
 
+    std::type_info const& _direct_class() const override;
+    bool _copy_to(SerializableObject* clone, Cloner&) const override;
+    bool _equals(SerializableObject const& other, Comparer&) const override;
+
 private:
     std::string   _generator_kind;
     AnyDictionary _parameters;
@@ -268,4 +268,45 @@ ImageSequenceReference::write_to(Writer& writer) const
     }
     writer.write("missing_frame_policy", missing_frame_policy_value);
 }
+
+std::type_info const&
+ImageSequenceReference::_direct_class() const
+{
+    return typeid(ImageSequenceReference);
+}
+
+bool
+ImageSequenceReference::_copy_to(
+    SerializableObject* clone,
+    Cloner&             cloner) const
+{
+    auto c                   = static_cast<ImageSequenceReference*>(clone);
+    c->_target_url_base      = _target_url_base;
+    c->_name_prefix          = _name_prefix;
+    c->_name_suffix          = _name_suffix;
+    c->_start_frame          = _start_frame;
+    c->_frame_step           = _frame_step;
+    c->_rate                 = _rate;
+    c->_frame_zero_padding   = _frame_zero_padding;
+    c->_missing_frame_policy = _missing_frame_policy;
+    return Parent::_copy_to(clone, cloner);
+}
+
+bool
+ImageSequenceReference::_equals(
+    SerializableObject const& other,
+    Comparer&                 comparer) const
+{
+    auto const& o = static_cast<ImageSequenceReference const&>(other);
+    return _target_url_base == o._target_url_base
+           && _name_prefix == o._name_prefix
+           && _name_suffix == o._name_suffix
+           && _start_frame == o._start_frame
+           && _frame_step == o._frame_step
+           && _rate == o._rate
+           && _frame_zero_padding == o._frame_zero_padding
+           && _missing_frame_policy == o._missing_frame_policy
+           && Parent::_equals(other, comparer);
+}
+
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
@@ -46,6 +46,7 @@ public:
     void set_target_url_base(std::string const& target_url_base)
     {
         _target_url_base = target_url_base;
+        content_changed();
     }
 
     std::string name_prefix() const noexcept { return _name_prefix; }
@@ -53,6 +54,7 @@ public:
     void set_name_prefix(std::string const& target_url_base)
     {
         _name_prefix = target_url_base;
+        content_changed();
     }
 
     std::string name_suffix() const noexcept { return _name_suffix; }
@@ -60,6 +62,7 @@ public:
     void set_name_suffix(std::string const& target_url_base)
     {
         _name_suffix = target_url_base;
+        content_changed();
     }
 
     int start_frame() const noexcept { return _start_frame; }
@@ -67,27 +70,38 @@ public:
     void set_start_frame(int start_frame) noexcept
     {
         _start_frame = start_frame;
+        content_changed();
     }
 
     int frame_step() const noexcept { return _frame_step; }
 
-    void set_frame_step(int frame_step) noexcept { _frame_step = frame_step; }
+    void set_frame_step(int frame_step) noexcept
+    {
+        _frame_step = frame_step;
+        content_changed();
+    }
 
     double rate() const noexcept { return _rate; }
 
-    void set_rate(double rate) noexcept { _rate = rate; }
+    void set_rate(double rate) noexcept
+    {
+        _rate = rate;
+        content_changed();
+    }
 
     int frame_zero_padding() const noexcept { return _frame_zero_padding; }
 
     void set_frame_zero_padding(int frame_zero_padding) noexcept
     {
         _frame_zero_padding = frame_zero_padding;
+        content_changed();
     }
 
     void
     set_missing_frame_policy(MissingFramePolicy missing_frame_policy) noexcept
     {
         _missing_frame_policy = missing_frame_policy;
+        content_changed();
     }
 
     MissingFramePolicy missing_frame_policy() const noexcept
@@ -115,6 +129,10 @@ protected:
     bool read_from(Reader&) override;
     void write_to(Writer&) const override;
 
+    std::type_info const& _direct_class() const override;
+    bool _copy_to(SerializableObject* clone, Cloner&) const override;
+    bool _equals(SerializableObject const& other, Comparer&) const override;
+
 private:
     std::string        _target_url_base;
     std::string        _name_prefix;
@@ -0,0 +1,180 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#include "opentimelineio/internedString.h"
+
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
+
+namespace {
+
+// Whether strings read on this thread are interned.
+thread_local bool _interning = false;
+
+} // namespace
+
+// Each entry is keyed by a view of its own value.  The count of an entry
+// only drops to zero, or rises from it, while the mutex is held, so an
+// entry found in the map is never one that is being removed.
+struct InternedString::_Pool
+{
+    std::mutex                                  mutex;
+    std::unordered_map<std::string_view, _Entry*> entries;
+};
+
+InternedString::_Pool&
+InternedString::_pool()
+{
+    // never destroyed, so that strings outliving static destruction can
+    // still be released
+    static _Pool* pool = new _Pool;
+    return *pool;
+}
+
+InternedString::InterningScope::InterningScope(bool intern)
+    : _saved(_interning)
+{
+    _interning = intern;
+}
+
+InternedString::InterningScope::~InterningScope()
+{
+    _interning = _saved;
+}
+
+InternedString::InternedString(InternedString const& other)
+    : _value(other._value)
+    , _entry(other._entry)
+{
+    if (_entry)
+    {
+        // the other string holds a reference, so the count is not zero
+        _entry->references.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+InternedString::InternedString(InternedString&& other) noexcept
+    : _value(std::move(other._value))
+    , _entry(other._entry)
+{
+    other._entry = nullptr;
+}
+
+InternedString&
+InternedString::operator=(InternedString const& other)
+{
+    if (this != &other)
+    {
+        InternedString copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+InternedString&
+InternedString::operator=(InternedString&& other) noexcept
+{
+    if (this != &other)
+    {
+        _release();
+        _value       = std::move(other._value);
+        _entry       = other._entry;
+        other._entry = nullptr;
+    }
+    return *this;
+}
+
+InternedString
+InternedString::intern(std::string const& value)
+{
+    _Pool&                      pool = _pool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+
+    InternedString result;
+    auto           it = pool.entries.find(value);
+    if (it != pool.entries.end())
+    {
+        result._entry = it->second;
+        result._entry->references.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+        result._entry = new _Entry{ value, { 1 } };
+        pool.entries.emplace(result._entry->value, result._entry);
+    }
+    return result;
+}
+
+bool
+InternedString::interning()
+{
+    return _interning;
+}
+
+InternedString
+InternedString::decoded(std::string&& value)
+{
+    if (_interning && !value.empty())
+    {
+        return intern(value);
+    }
+    return InternedString(std::move(value));
+}
+
+InternedString::PoolStats
+InternedString::pool_stats()
+{
+    _Pool&                      pool = _pool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+
+    PoolStats stats;
+    for (auto const& e: pool.entries)
+    {
+        const size_t references =
+            e.second->references.load(std::memory_order_relaxed);
+        stats.strings++;
+        stats.references += references;
+        stats.bytes += e.first.size();
+        stats.referenced_bytes += e.first.size() * references;
+    }
+    return stats;
+}
+
+void
+InternedString::_release() noexcept
+{
+    if (!_entry)
+    {
+        return;
+    }
+
+    _Entry* entry = _entry;
+    _entry        = nullptr;
+
+    // drop a reference that is not the last without taking the lock
+    size_t references = entry->references.load(std::memory_order_relaxed);
+    while (references > 1)
+    {
+        if (entry->references.compare_exchange_weak(
+                references,
+                references - 1,
+                std::memory_order_release,
+                std::memory_order_relaxed))
+        {
+            return;
+        }
+    }
+
+    _Pool&                      pool = _pool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    if (entry->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        pool.entries.erase(entry->value);
+        delete entry;
+    }
+}
+
+}} // namespace opentimelineio::OPENTIMELINEIO_VERSION
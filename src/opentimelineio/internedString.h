@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Contributors to the OpenTimelineIO project
+
+#pragma once
+
+#include "opentimelineio/version.h"
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+
+namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
+
+/**
+ * A string field that holds its value either by itself, like a std::string,
+ * or as a reference to the one copy of that value kept in a process-wide
+ * pool.
+ *
+ * Names, marker colors and media URLs are held this way.  Documents read
+ * with interning turned on (see ReadOptions::intern_strings) keep one copy
+ * of each distinct value, however many objects share it, and two interned
+ * strings compare equal exactly when they are the same pool entry.  A value
+ * is removed from the pool once the last string referring to it is gone.
+ *
+ * Setting a field replaces its value with a string of its own; the pool is
+ * only populated by the decoder or by intern().
+ */
+class InternedString
+{
+public:
+    // The contents of the pool.  Sizes count characters, not the memory
+    // overhead of the pool itself.
+    struct PoolStats
+    {
+        size_t strings    = 0; // distinct values in the pool
+        size_t references = 0; // strings referring to them
+
+        size_t bytes            = 0; // size of the pooled values
+        size_t referenced_bytes = 0; // size of every reference's value
+
+        // what referring to the pool has saved over separate copies
+        size_t bytes_saved() const { return referenced_bytes - bytes; }
+    };
+
+    // While an InterningScope constructed with true exists on a thread, the
+    // strings the decoder reads into fields on that thread are interned.
+    class InterningScope
+    {
+    public:
+        explicit InterningScope(bool intern);
+        ~InterningScope();
+
+        InterningScope(InterningScope const&)            = delete;
+        InterningScope& operator=(InterningScope const&) = delete;
+
+    private:
+        bool _saved;
+    };
+
+    InternedString() noexcept = default;
+
+    InternedString(std::string const& value)
+        : _value(value)
+    {}
+
+    InternedString(std::string&& value) noexcept
+        : _value(std::move(value))
+    {}
+
+    InternedString(InternedString const& other);
+    InternedString(InternedString&& other) noexcept;
+
+    ~InternedString() { _release(); }
+
+    InternedString& operator=(InternedString const& other);
+    InternedString& operator=(InternedString&& other) noexcept;
+
+    InternedString& operator=(std::string const& value)
+    {
+        _release();
+        _value = value;
+        return *this;
+    }
+
+    // The string with the given value from the pool, added if need be.
+    static InternedString intern(std::string const& value);
+
+    // True if strings read on this thread are currently interned.
+    static bool interning();
+
+    // The string the decoder keeps for a value it has read: interned if
+    // interning() and the value is not empty, otherwise a string of its own.
+    static InternedString decoded(std::string&& value);
+
+    static PoolStats pool_stats();
+
+    std::string const& str() const noexcept
+    {
+        return _entry ? _entry->value : _value;
+    }
+
+    operator std::string const&() const noexcept { return str(); }
+
+    bool is_interned() const noexcept { return _entry != nullptr; }
+
+    friend bool
+    operator==(InternedString const& lhs, InternedString const& rhs) noexcept
+    {
+        if (lhs._entry && rhs._entry)
+        {
+            return lhs._entry == rhs._entry;
+        }
+        return lhs.str() == rhs.str();
+    }
+
+    friend bool
+    operator!=(InternedString const& lhs, InternedString const& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    struct _Entry
+    {
+        std::string         value;
+        std::atomic<size_t> references;
+    };
+
+    struct _Pool;
+    static _Pool& _pool();
+
+    void _release() noexcept;
+
+    // _value is empty while the string refers to a pool entry
+    std::string _value;
+    _Entry*     _entry = nullptr;
+};
+
+}} // namespace opentimelineio::OPENTIMELINEIO_VERSION
@@ -22,7 +22,9 @@ Item::Item(
     , _effects(effects.begin(), effects.end())
     , _markers(markers.begin(), markers.end())
     , _enabled(enabled)
-{}
+{
+    _hold_effects();
+}
 
 Item::~Item()
 {}
@@ -112,50 +114,26 @@ Item::transformed_time(
     Item const*  to_item,
     ErrorStatus* error_status) const
 {
-    if (!to_item)
+    if (!to_item || to_item == this)
     {
         return time;
     }
 
-    auto root   = _highest_ancestor();
-    auto item   = this;
-    auto result = time;
-
-    while (item != root && item != to_item)
+    // both items are mapped into the space of their common root, so a
+    // conversion costs two cache lookups rather than a walk of the tree
+    auto offset = _offset_in_root(error_status);
+    if (is_error(error_status))
     {
-        auto parent = item->parent();
-        result -= item->trimmed_range(error_status).start_time();
-        if (is_error(error_status))
-        {
-            return result;
-        }
-
-        result += parent->range_of_child(item, error_status).start_time();
-        item = parent;
+        return time;
     }
 
-    auto ancestor = item;
-    item          = to_item;
-    while (item != root && item != ancestor)
+    auto to_offset = to_item->_offset_in_root(error_status);
+    if (is_error(error_status))
     {
-        auto parent = item->parent();
-        result += item->trimmed_range(error_status).start_time();
-        if (is_error(error_status))
-        {
-            return result;
-        }
-
-        result -= parent->range_of_child(item, error_status).start_time();
-        if (is_error(error_status))
-        {
-            return result;
-        }
-
-        item = parent;
+        return time;
     }
 
-    assert(item == ancestor);
-    return result;
+    return time + (offset - to_offset);
 }
 
 TimeRange
@@ -169,12 +147,62 @@ Item::transformed_time_range(
         time_range.duration());
 }
 
+RationalTime
+Item::_offset_in_root(ErrorStatus* error_status) const
+{
+    auto parent = this->parent();
+    if (!parent)
+    {
+        return RationalTime();
+    }
+
+    const int index = parent->index_of_child(this, error_status);
+    if (is_error(error_status))
+    {
+        return RationalTime();
+    }
+
+    auto offset =
+        parent->range_of_child_at_index(index, error_status).start_time();
+    if (is_error(error_status))
+    {
+        return RationalTime();
+    }
+
+    offset -= trimmed_range(error_status).start_time();
+    if (is_error(error_status))
+    {
+        return RationalTime();
+    }
+
+    offset += parent->_offset_in_root(error_status);
+    if (is_error(error_status))
+    {
+        return RationalTime();
+    }
+    return offset;
+}
+
+void
+Item::_hold_effects()
+{
+    for (auto const& effect: _effects)
+    {
+        _hold(effect.value);
+    }
+}
+
 bool
 Item::read_from(Reader& reader)
 {
-    return reader.read_if_present("source_range", &_source_range)
-           && reader.read_if_present("effects", &_effects)
-           && reader.read_if_present("markers", &_markers)
+    if (!reader.read_if_present("source_range", &_source_range)
+        || !reader.read_if_present("effects", &_effects))
+    {
+        return false;
+    }
+
+    _hold_effects();
+    return reader.read_if_present("markers", &_markers)
            && reader.read_if_present("enabled", &_enabled)
            && Parent::read_from(reader);
 }
@@ -189,4 +217,37 @@ Item::write_to(Writer& writer) const
     writer.write("enabled", _enabled);
 }
 
+std::type_info const&
+Item::_direct_class() const
+{
+    return typeid(Item);
+}
+
+bool
+Item::_copy_to(SerializableObject* clone, Cloner& cloner) const
+{
+    auto c           = static_cast<Item*>(clone);
+    c->_source_range = _source_range;
+    c->_enabled      = _enabled;
+    if (!cloner.copy(_effects, &c->_effects))
+    {
+        return false;
+    }
+
+    c->_hold_effects();
+    return cloner.copy(_markers, &c->_markers)
+           && Parent::_copy_to(clone, cloner);
+}
+
+bool
+Item::_equals(SerializableObject const& other, Comparer& comparer) const
+{
+    auto const& o = static_cast<Item const&>(other);
+    return _source_range == o._source_range
+           && _enabled == o._enabled
+           && Parent::_equals(other, comparer)
+           && comparer.equal(_effects, o._effects)
+           && comparer.equal(_markers, o._markers);
+}
+
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
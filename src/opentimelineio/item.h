@@ -37,7 +37,11 @@ public:
 
     bool enabled() const { return _enabled; };
 
-    void set_enabled(bool enabled) { _enabled = enabled; }
+    void set_enabled(bool enabled)
+    {
+        _enabled = enabled;
+        _timing_changed();
+    }
 
     std::optional<TimeRange> source_range() const noexcept
     {
@@ -47,16 +51,30 @@ public:
     void set_source_range(std::optional<TimeRange> const& source_range)
     {
         _source_range = source_range;
+        _timing_changed();
     }
 
-    std::vector<Retainer<Effect>>& effects() noexcept { return _effects; }
+    // Handing out the effects counts as a change to them, and the effects
+    // already in the list start reporting their own changes to this item.
+    // An effect added through the returned reference is picked up at the
+    // next call, or when the item is read or cloned.
+    std::vector<Retainer<Effect>>& effects()
+    {
+        _hold_effects();
+        _timing_changed();
+        return _effects;
+    }
 
     std::vector<Retainer<Effect>> const& effects() const noexcept
     {
         return _effects;
     }
 
-    std::vector<Retainer<Marker>>& markers() noexcept { return _markers; }
+    std::vector<Retainer<Marker>>& markers() noexcept
+    {
+        content_changed();
+        return _markers;
+    }
 
     std::vector<Retainer<Marker>> const& markers() const noexcept
     {
@@ -96,11 +114,26 @@ protected:
     bool read_from(Reader&) override;
     void write_to(Writer&) const override;
 
+    std::type_info const& _direct_class() const override;
+    bool _copy_to(SerializableObject* clone, Cloner&) const override;
+    bool _equals(SerializableObject const& other, Comparer&) const override;
+
 private:
+    // Return the offset that maps a time in this item's space into the space
+    // of its highest ancestor.  Each level up is a lookup in the child
+    // position index and cached range table of the parent, so this costs
+    // one step per level rather than a scan of the siblings.
+    RationalTime _offset_in_root(ErrorStatus* error_status) const;
+
+    // Have each effect report its changes to this item.
+    void _hold_effects();
+
     std::optional<TimeRange>      _source_range;
     std::vector<Retainer<Effect>> _effects;
     std::vector<Retainer<Marker>> _markers;
     bool                          _enabled;
+
+    friend class JSONDecoder;
 };
 
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
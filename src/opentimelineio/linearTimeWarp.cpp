@@ -31,4 +31,27 @@ LinearTimeWarp::write_to(Writer& writer) const
     writer.write("time_scalar", _time_scalar);
 }
 
+std::type_info const&
+LinearTimeWarp::_direct_class() const
+{
+    return typeid(LinearTimeWarp);
+}
+
+bool
+LinearTimeWarp::_copy_to(SerializableObject* clone, Cloner& cloner) const
+{
+    static_cast<LinearTimeWarp*>(clone)->_time_scalar = _time_scalar;
+    return Parent::_copy_to(clone, cloner);
+}
+
+bool
+LinearTimeWarp::_equals(
+    SerializableObject const& other,
+    Comparer&                 comparer) const
+{
+    auto const& o = static_cast<LinearTimeWarp const&>(other);
+    return _time_scalar == o._time_scalar
+           && Parent::_equals(other, comparer);
+}
+
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
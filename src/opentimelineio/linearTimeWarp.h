@@ -30,6 +30,7 @@ public:
     void set_time_scalar(double time_scalar) noexcept
     {
         _time_scalar = time_scalar;
+        _effect_changed();
     }
 
 protected:
@@ -38,6 +39,10 @@ protected:
     bool read_from(Reader&) override;
     void write_to(Writer&) const override;
 
+    std::type_info const& _direct_class() const override;
+    bool _copy_to(SerializableObject* clone, Cloner&) const override;
+    bool _equals(SerializableObject const& other, Comparer&) const override;
+
 private:
     double _time_scalar;
 };
@@ -39,4 +39,30 @@ Marker::write_to(Writer& writer) const
     writer.write("comment", _comment);
 }
 
+std::type_info const&
+Marker::_direct_class() const
+{
+    return typeid(Marker);
+}
+
+bool
+Marker::_copy_to(SerializableObject* clone, Cloner& cloner) const
+{
+    auto c           = static_cast<Marker*>(clone);
+    c->_color        = _color;
+    c->_marked_range = _marked_range;
+    c->_comment      = _comment;
+    return Parent::_copy_to(clone, cloner);
+}
+
+bool
+Marker::_equals(SerializableObject const& other, Comparer& comparer) const
+{
+    auto const& o = static_cast<Marker const&>(other);
+    return _color == o._color
+           && _marked_range == o._marked_range
+           && _comment == o._comment
+           && Parent::_equals(other, comparer);
+}
+
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
@@ -43,18 +43,27 @@ public:
 
     std::string color() const noexcept { return _color; }
 
-    void set_color(std::string const& color) { _color = color; }
+    void set_color(std::string const& color)
+    {
+        _color = color;
+        content_changed();
+    }
 
     TimeRange marked_range() const noexcept { return _marked_range; }
 
     void set_marked_range(TimeRange const& marked_range) noexcept
     {
         _marked_range = marked_range;
+        content_changed();
     }
 
     std::string comment() const noexcept { return _comment; }
 
-    void set_comment(std::string const& comment) { _comment = comment; }
+    void set_comment(std::string const& comment)
+    {
+        _comment = comment;
+        content_changed();
+    }
 
 protected:
     virtual ~Marker();
@@ -62,10 +71,14 @@ protected:
     bool read_from(Reader&) override;
     void write_to(Writer&) const override;
 
+    std::type_info const& _direct_class() const override;
+    bool _copy_to(SerializableObject* clone, Cloner&) const override;
+    bool _equals(SerializableObject const& other, Comparer&) const override;
+
 private:
-    std::string _color;
-    TimeRange   _marked_range;
-    std::string _comment;
+    InternedString _color;
+    TimeRange      _marked_range;
+    std::string    _comment;
 };
 
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
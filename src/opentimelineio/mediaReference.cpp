@@ -2,6 +2,7 @@
 // Copyright Contributors to the OpenTimelineIO project
 
 #include "opentimelineio/mediaReference.h"
+#include "opentimelineio/composable.h"
 
 namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
 
@@ -18,6 +19,34 @@ MediaReference::MediaReference(
 MediaReference::~MediaReference()
 {}
 
+void
+MediaReference::set_available_range(
+    std::optional<TimeRange> const& available_range)
+{
+    _available_range = available_range;
+    _timing_changed();
+}
+
+void
+MediaReference::set_available_image_bounds(
+    std::optional<IMATH_NAMESPACE::Box2d> const& available_image_bounds)
+{
+    _available_image_bounds = available_image_bounds;
+    _timing_changed();
+}
+
+void
+MediaReference::_timing_changed() noexcept
+{
+    content_changed();
+    _for_each_holder([](SerializableObject* holder) {
+        if (auto composable = dynamic_cast<Composable*>(holder))
+        {
+            composable->mark_modified();
+        }
+    });
+}
+
 bool
 MediaReference::is_missing_reference() const
 {
@@ -42,4 +71,30 @@ MediaReference::write_to(Writer& writer) const
     writer.write("available_image_bounds", _available_image_bounds);
 }
 
+std::type_info const&
+MediaReference::_direct_class() const
+{
+    return typeid(MediaReference);
+}
+
+bool
+MediaReference::_copy_to(SerializableObject* clone, Cloner& cloner) const
+{
+    auto c                     = static_cast<MediaReference*>(clone);
+    c->_available_range        = _available_range;
+    c->_available_image_bounds = _available_image_bounds;
+    return Parent::_copy_to(clone, cloner);
+}
+
+bool
+MediaReference::_equals(
+    SerializableObject const& other,
+    Comparer&                 comparer) const
+{
+    auto const& o = static_cast<MediaReference const&>(other);
+    return _available_range == o._available_range
+           && _available_image_bounds == o._available_image_bounds
+           && Parent::_equals(other, comparer);
+}
+
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
@@ -35,10 +35,10 @@ public:
         return _available_range;
     }
 
-    void set_available_range(std::optional<TimeRange> const& available_range)
-    {
-        _available_range = available_range;
-    }
+    // Changing the available range or image bounds counts as a change to
+    // the timing of the clips holding the reference (see
+    // Composable::modification_stamp()).
+    void set_available_range(std::optional<TimeRange> const& available_range);
 
     virtual bool is_missing_reference() const;
 
@@ -48,10 +48,7 @@ public:
     }
 
     void set_available_image_bounds(
-        std::optional<IMATH_NAMESPACE::Box2d> const& available_image_bounds)
-    {
-        _available_image_bounds = available_image_bounds;
-    }
+        std::optional<IMATH_NAMESPACE::Box2d> const& available_image_bounds);
 
 protected:
     virtual ~MediaReference();
@@ -59,9 +56,18 @@ protected:
     bool read_from(Reader&) override;
     void write_to(Writer&) const override;
 
+    std::type_info const& _direct_class() const override;
+    bool _copy_to(SerializableObject* clone, Cloner&) const override;
+    bool _equals(SerializableObject const& other, Comparer&) const override;
+
 private:
+    // Bump the modification stamps of the clips holding this reference.
+    void _timing_changed() noexcept;
+
     std::optional<TimeRange>              _available_range;
     std::optional<IMATH_NAMESPACE::Box2d> _available_image_bounds;
+
+    friend class JSONDecoder;
 };
 
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
@@ -34,4 +34,10 @@ MissingReference::write_to(Writer& writer) const
     Parent::write_to(writer);
 }
 
+std::type_info const&
+MissingReference::_direct_class() const
+{
+    return typeid(MissingReference);
+}
+
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
@@ -3,8 +3,63 @@
 
 #include "opentimelineio/safely_typed_any.h"
 
+#include <typeinfo>
+
 namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
 
+namespace {
+struct _KnownType
+{
+    std::type_info const* type;
+    AnyKind               kind;
+};
+
+// the most common kinds come first
+const _KnownType _known_types[] = {
+    { &typeid(std::string), AnyKind::string_value },
+    { &typeid(double), AnyKind::double_value },
+    { &typeid(int64_t), AnyKind::int64_value },
+    { &typeid(AnyDictionary), AnyKind::dictionary_value },
+    { &typeid(AnyVector), AnyKind::vector_value },
+    { &typeid(SerializableObject::Retainer<>), AnyKind::object_value },
+    { &typeid(bool), AnyKind::bool_value },
+    { &typeid(void), AnyKind::null_value },
+    { &typeid(RationalTime), AnyKind::rational_time_value },
+    { &typeid(TimeRange), AnyKind::time_range_value },
+    { &typeid(int), AnyKind::int_value },
+    { &typeid(uint64_t), AnyKind::uint64_value },
+    { &typeid(char const*), AnyKind::c_string_value },
+    { &typeid(TimeTransform), AnyKind::time_transform_value },
+    { &typeid(IMATH_NAMESPACE::V2d), AnyKind::point_value },
+    { &typeid(IMATH_NAMESPACE::Box2d), AnyKind::box_value },
+    { &typeid(SerializableObject::ReferenceId),
+      AnyKind::reference_id_value },
+};
+} // namespace
+
+AnyKind
+safely_typed_any_kind(std::any const& a)
+{
+    std::type_info const& type = a.type();
+    for (auto const& known: _known_types)
+    {
+        if (known.type == &type)
+        {
+            return known.kind;
+        }
+    }
+
+    // the same type may have another type_info in another library
+    for (auto const& known: _known_types)
+    {
+        if (*known.type == type)
+        {
+            return known.kind;
+        }
+    }
+    return AnyKind::other;
+}
+
 std::any
 create_safely_typed_any(bool&& value)
 {
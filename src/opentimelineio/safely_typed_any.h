@@ -27,6 +27,36 @@
 
 namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
 
+// The kinds of value OTIO stores in a std::any: the JSON representable
+// ones, the opentime and Imath value types, objects and containers.  Code
+// that handles each of them switches on the kind rather than looking the
+// type up.
+enum class AnyKind
+{
+    null_value, // an empty std::any
+    bool_value,
+    int_value,
+    int64_value,
+    uint64_value,
+    double_value,
+    string_value,
+    c_string_value, // char const*
+    rational_time_value,
+    time_range_value,
+    time_transform_value,
+    point_value, // IMATH_NAMESPACE::V2d
+    box_value,   // IMATH_NAMESPACE::Box2d
+    object_value, // SerializableObject::Retainer<>
+    reference_id_value,
+    dictionary_value,
+    vector_value,
+    other
+};
+
+// The kind of value a holds.  Types that arrive from another shared library
+// under a different type_info are recognized by name.
+AnyKind safely_typed_any_kind(std::any const& a);
+
 std::any create_safely_typed_any(bool&&);
 std::any create_safely_typed_any(int&&);
 std::any create_safely_typed_any(int64_t&&);
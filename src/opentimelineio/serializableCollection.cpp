@@ -22,6 +22,7 @@ void
 SerializableCollection::clear_children()
 {
     _children.clear();
+    content_changed();
 }
 
 void
@@ -29,6 +30,7 @@ SerializableCollection::set_children(
     std::vector<SerializableObject*> const& children)
 {
     _children = decltype(_children)(children.begin(), children.end());
+    content_changed();
 }
 
 void
@@ -43,6 +45,7 @@ SerializableCollection::insert_child(int index, SerializableObject* child)
     {
         _children.insert(_children.begin() + std::max(index, 0), child);
     }
+    content_changed();
 }
 
 bool
@@ -62,6 +65,7 @@ SerializableCollection::set_child(
     }
 
     _children[index] = child;
+    content_changed();
     return true;
 }
 
@@ -88,6 +92,7 @@ SerializableCollection::remove_child(int index, ErrorStatus* error_status)
         _children.erase(_children.begin() + std::max(index, 0));
     }
 
+    content_changed();
     return true;
 }
 
@@ -104,6 +109,32 @@ SerializableCollection::write_to(Writer& writer) const
     writer.write("children", _children);
 }
 
+std::type_info const&
+SerializableCollection::_direct_class() const
+{
+    return typeid(SerializableCollection);
+}
+
+bool
+SerializableCollection::_copy_to(
+    SerializableObject* clone,
+    Cloner&             cloner) const
+{
+    auto c = static_cast<SerializableCollection*>(clone);
+    return cloner.copy(_children, &c->_children)
+           && Parent::_copy_to(clone, cloner);
+}
+
+bool
+SerializableCollection::_equals(
+    SerializableObject const& other,
+    Comparer&                 comparer) const
+{
+    auto const& o = static_cast<SerializableCollection const&>(other);
+    return Parent::_equals(other, comparer)
+           && comparer.equal(_children, o._children);
+}
+
 std::vector<SerializableObject::Retainer<Clip>>
 SerializableCollection::find_clips(
     ErrorStatus*                    error_status,
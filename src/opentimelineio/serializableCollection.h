@@ -36,6 +36,7 @@ public:
 
     std::vector<Retainer<SerializableObject>>& children() noexcept
     {
+        content_changed();
         return _children;
     }
 
@@ -79,6 +80,10 @@ protected:
     bool read_from(Reader&) override;
     void write_to(Writer&) const override;
 
+    std::type_info const& _direct_class() const override;
+    bool _copy_to(SerializableObject* clone, Cloner&) const override;
+    bool _equals(SerializableObject const& other, Comparer&) const override;
+
 private:
     std::vector<Retainer<SerializableObject>> _children;
 };
@@ -119,16 +124,14 @@ SerializableCollection::find_children(
             }
             else if (auto composition = dynamic_cast<Composition*>(child.value))
             {
-                const auto valid_children =
-                    composition->find_children<T>(error_status, search_range);
+                composition->for_each_child<T>(
+                    [&out](T* valid_child) { out.emplace_back(valid_child); },
+                    error_status,
+                    search_range);
                 if (is_error(error_status))
                 {
                     return out;
                 }
-                for (const auto& valid_child: valid_children)
-                {
-                    out.push_back(valid_child);
-                }
             }
             else if (auto timeline = dynamic_cast<Timeline*>(child.value))
             {
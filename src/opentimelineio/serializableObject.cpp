@@ -7,16 +7,65 @@
 #include "stringUtils.h"
 #include "typeRegistry.h"
 
+#include <algorithm>
+#include <mutex>
+
 namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
 
+namespace {
+// Installing a keepalive monitor is rare, so one lock serves all objects.
+std::mutex _keepalive_monitor_mutex;
+
+// Holders are recorded while loading and hashing, which rarely contend, so
+// one lock serves all objects here too.
+std::mutex _holders_mutex;
+}
+
 SerializableObject::SerializableObject()
     : _cached_type_record(nullptr)
+    , _managed_ref_count(0)
+    , _has_external_keepalive_monitor(false)
+{}
+
+SerializableObject::~SerializableObject()
 {
-    _managed_ref_count = 0;
+    if (_holder_cell)
+    {
+        _holder_cell->object = nullptr;
+    }
 }
 
-SerializableObject::~SerializableObject()
-{}
+void
+SerializableObject::_hold(SerializableObject const* held) const
+{
+    if (!held)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_holders_mutex);
+    if (!_holder_cell)
+    {
+        _holder_cell         = std::make_shared<_HolderCell>();
+        _holder_cell->object = const_cast<SerializableObject*>(this);
+    }
+
+    // drop holders that are gone while looking for this one
+    auto& holders = held->_holders;
+    holders.erase(
+        std::remove_if(
+            holders.begin(),
+            holders.end(),
+            [](std::shared_ptr<_HolderCell> const& cell) {
+                return !cell->object.load();
+            }),
+        holders.end());
+    if (std::find(holders.begin(), holders.end(), _holder_cell)
+        == holders.end())
+    {
+        holders.push_back(_holder_cell);
+    }
+}
 
 // forwarded functions
 std::string
@@ -40,28 +89,30 @@ SerializableObject::Reader::fwd_type_name_for_error_message(
 TypeRegistry::_TypeRecord const*
 SerializableObject::_type_record() const
 {
-    std::lock_guard<std::mutex> lock(_mutex);
-    if (!_cached_type_record)
+    // the lookup always gives the same answer, so racing threads may both
+    // perform it without harm
+    auto type_record = _cached_type_record.load(std::memory_order_acquire);
+    if (!type_record)
     {
-        _cached_type_record =
+        type_record =
             TypeRegistry::instance()._lookup_type_record(typeid(*this));
-        if (!_cached_type_record)
+        if (!type_record)
         {
             fatal_error(string_printf(
                 "Code for C++ type %s has not been registered via "
                 "TypeRegistry::register_type<T>()",
                 type_name_for_error_message(typeid(*this)).c_str()));
         }
+        _cached_type_record.store(type_record, std::memory_order_release);
     }
 
-    return _cached_type_record;
+    return type_record;
 }
 
 bool
 SerializableObject::_is_deletable()
 {
-    std::lock_guard<std::mutex> lock(_mutex);
-    return _managed_ref_count == 0;
+    return _managed_ref_count.load(std::memory_order_acquire) == 0;
 }
 
 bool
@@ -82,7 +133,7 @@ SerializableObject::read_from(Reader& reader)
      * Want to move everything from reader._dict into
      * _dynamic_fields, overwriting as we go.
      */
-    for (auto& e: reader._dict)
+    for (auto&& e: reader._dict)
     {
         auto it = _dynamic_fields.find(e.first);
         if (it != _dynamic_fields.end())
@@ -143,10 +194,13 @@ SerializableObject::to_json_file(
 SerializableObject*
 SerializableObject::from_json_string(
     std::string const& input,
-    ErrorStatus*       error_status)
+    ErrorStatus*       error_status,
+    ReadOptions const& options)
 {
     std::any dest;
 
+    InternedString::InterningScope interning_scope(options.intern_strings);
+
     if (!deserialize_json_from_string(input, &dest, error_status))
     {
         return nullptr;
@@ -171,10 +225,13 @@ SerializableObject::from_json_string(
 SerializableObject*
 SerializableObject::from_json_file(
     std::string const& file_name,
-    ErrorStatus*       error_status)
+    ErrorStatus*       error_status,
+    ReadOptions const& options)
 {
     std::any dest;
 
+    InternedString::InterningScope interning_scope(options.intern_strings);
+
     if (!deserialize_json_from_file(file_name, &dest, error_status))
     {
         return nullptr;
@@ -205,10 +262,10 @@ SerializableObject::_schema_name_for_reference() const
 void
 SerializableObject::_managed_retain()
 {
+    if (_managed_ref_count.fetch_add(1, std::memory_order_relaxed) != 1
+        || !_has_external_keepalive_monitor.load(std::memory_order_acquire))
     {
-        std::lock_guard<std::mutex> lock(_mutex);
-        if (_managed_ref_count++ != 1 || !_external_keepalive_monitor)
-            return;
+        return;
     }
 
     // We just changed from unique (old ref count was 1) to non-unique
@@ -219,25 +276,22 @@ SerializableObject::_managed_retain()
 void
 SerializableObject::_managed_release()
 {
-    _mutex.lock();
-
-    if (--_managed_ref_count == 0)
+    const int old_count =
+        _managed_ref_count.fetch_sub(1, std::memory_order_acq_rel);
+    if (old_count == 1)
     {
-        _mutex.unlock();
         delete this;
         return;
     }
 
-    if (_managed_ref_count != 1 || !_external_keepalive_monitor)
+    if (old_count != 2
+        || !_has_external_keepalive_monitor.load(std::memory_order_acquire))
     {
-        _mutex.unlock();
         return;
     }
 
     // We just changed back to unique (new ref count is 1)
     // and we know we have a monitor.
-
-    _mutex.unlock();
     _external_keepalive_monitor();
 }
 
@@ -247,10 +301,13 @@ SerializableObject::install_external_keepalive_monitor(
     bool                  apply_now)
 {
     {
-        std::lock_guard<std::mutex> lock(_mutex);
-        if (!_external_keepalive_monitor)
+        std::lock_guard<std::mutex> lock(_keepalive_monitor_mutex);
+        if (!_has_external_keepalive_monitor.load(std::memory_order_relaxed))
         {
             _external_keepalive_monitor = monitor;
+            _has_external_keepalive_monitor.store(
+                true,
+                std::memory_order_release);
         }
     }
 
@@ -263,8 +320,7 @@ SerializableObject::install_external_keepalive_monitor(
 int
 SerializableObject::current_ref_count() const
 {
-    std::lock_guard<std::mutex> lock(_mutex);
-    return _managed_ref_count;
+    return _managed_ref_count.load(std::memory_order_acquire);
 }
 
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
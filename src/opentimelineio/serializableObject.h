@@ -9,20 +9,34 @@
 #include "opentimelineio/anyDictionary.h"
 #include "opentimelineio/anyVector.h"
 #include "opentimelineio/errorStatus.h"
+#include "opentimelineio/internedString.h"
 #include "opentimelineio/typeRegistry.h"
 #include "opentimelineio/version.h"
 
 #include "Imath/ImathBox.h"
 #include "serialization.h"
 
+#include <atomic>
 #include <list>
+#include <map>
+#include <memory>
 #include <optional>
+#include <typeinfo>
 #include <unordered_map>
+#include <vector>
 
 namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
 
 class CloningEncoder;
 
+// Options for SerializableObject::from_json_file() and from_json_string().
+struct ReadOptions
+{
+    // Store names, marker colors and media URLs that repeat once (see
+    // InternedString).
+    bool intern_strings = false;
+};
+
 class SerializableObject
 {
 public:
@@ -58,13 +72,42 @@ public:
 
     static SerializableObject* from_json_file(
         std::string const& file_name,
-        ErrorStatus*       error_status = nullptr);
+        ErrorStatus*       error_status = nullptr,
+        ReadOptions const& options      = ReadOptions());
     static SerializableObject* from_json_string(
         std::string const& input,
-        ErrorStatus*       error_status = nullptr);
+        ErrorStatus*       error_status = nullptr,
+        ReadOptions const& options      = ReadOptions());
 
     bool is_equivalent_to(SerializableObject const& other) const;
 
+    struct ContentHash;
+
+    // A digest of everything this object would serialize: its schema and
+    // fields, including metadata, and those of the objects it holds.  Two
+    // objects that serialize identically have the same digest, and it does
+    // not change from one run or platform to another.
+    //
+    // The digest of this object and of each object below it is cached until
+    // content_changed() is called on it, or on an object below it.  The
+    // setters and non-const accessors of the schemas call it; anything that
+    // edits an object through a reference kept from an earlier call, such
+    // as the result of metadata(), must call it on that object too.
+    //
+    // Hashing an object records that it holds each object written within
+    // it, so a change only drops the digests of the changed object and of
+    // the objects above it, and the next call rehashes just those.  The
+    // caches may be filled by calls on the same objects from several
+    // threads at once.
+    //
+    // If the object cannot be serialized, for example because it holds
+    // itself, an empty digest is returned and error_status is set.
+    ContentHash content_hash(ErrorStatus* error_status = nullptr) const;
+
+    // Mark the cached content hash of this object, and of every object that
+    // holds it, as out of date.
+    void content_changed() noexcept;
+
     // Makes a (deep) clone of this instance.
     //
     // Descendent SerializableObjects are cloned as well.
@@ -74,7 +117,11 @@ public:
 
     // Allow external system (e.g. Python, Swift) to add serializable fields
     // on the fly.  C++ implementations should have no need for this functionality.
-    AnyDictionary& dynamic_fields() { return _dynamic_fields; }
+    AnyDictionary& dynamic_fields()
+    {
+        content_changed();
+        return _dynamic_fields;
+    }
 
     template <typename T = SerializableObject>
     struct Retainer;
@@ -94,6 +141,7 @@ public:
         bool read(std::string const& key, int* dest);
         bool read(std::string const& key, double* dest);
         bool read(std::string const& key, std::string* dest);
+        bool read(std::string const& key, InternedString* dest);
         bool read(std::string const& key, RationalTime* dest);
         bool read(std::string const& key, TimeRange* dest);
         bool read(std::string const& key, class TimeTransform* dest);
@@ -130,8 +178,11 @@ public:
         template <typename T>
         bool read(std::string const& key, Retainer<T>* dest)
         {
+            // the value read may hold the only reference to the object, so
+            // keep it until dest has taken its own
+            std::any            a;
             SerializableObject* so;
-            if (!read(key, &so))
+            if (!read(key, &a) || !_from_any(a, &so))
             {
                 return false;
             }
@@ -187,9 +238,14 @@ public:
             std::map<std::string, SerializableObject*>   object_for_id;
             std::map<SerializableObject*, int>           line_number_for_object;
 
+            // The number of object references decoded so far.  A decoder
+            // compares it before and after an object to learn whether the
+            // object holds any references that may need resolving.
+            size_t reference_count = 0;
+
             void finalize(error_function_t error_function)
             {
-                for (auto e: data_for_object)
+                for (auto& e: data_for_object)
                 {
                     int line_number = line_number_for_object[e.first];
                     Reader::_fix_reference_ids(
@@ -203,7 +259,11 @@ public:
             }
         };
 
-        std::any _decode(_Resolver& resolver);
+        // Convert the dictionary to the value or object it describes.  An
+        // object is read from the dictionary straight away unless
+        // has_references is set, in which case reading is deferred to
+        // resolver.finalize(), when every referenced object is known.
+        std::any _decode(_Resolver& resolver, bool has_references = true);
 
         template <typename T>
         bool _from_any(std::any const& source, std::vector<T>* dest)
@@ -416,6 +476,10 @@ public:
         void write(std::string const& key, int64_t value);
         void write(std::string const& key, double value);
         void write(std::string const& key, std::string const& value);
+        void write(std::string const& key, InternedString const& value)
+        {
+            write(key, value.str());
+        }
         void write(std::string const& key, RationalTime value);
         void write(std::string const& key, TimeRange value);
         void write(std::string const& key, IMATH_NAMESPACE::V2d value);
@@ -526,16 +590,13 @@ public:
             : _encoder(encoder)
             , _downgrade_version_manifest(downgrade_version_manifest)
 
-        {
-            _build_dispatch_tables();
-        }
+        {}
 
         ~Writer();
 
         Writer(Writer const&)           = delete;
         Writer operator=(Writer const&) = delete;
 
-        void _build_dispatch_tables();
         void _write(std::string const& key, std::any const& value);
         void _encoder_write_key(std::string const& key);
 
@@ -544,20 +605,15 @@ public:
         bool _any_equals(std::any const& lhs, std::any const& rhs);
 
         std::string _no_key;
-        std::unordered_map<
-            std::type_info const*,
-            std::function<void(std::any const&)>>
-            _write_dispatch_table;
-        std::unordered_map<
-            std::type_info const*,
-            std::function<bool(std::any const&, std::any const&)>>
-            _equality_dispatch_table;
-
-        std::unordered_map<std::string, std::function<void(std::any const&)>>
-            _write_dispatch_table_by_name;
-        std::unordered_map<SerializableObject const*, std::string>
-                                             _id_for_object;
-        std::unordered_map<std::string, int> _next_id_for_type;
+
+        // With instancing support, the number in the id of each object
+        // written so far, and the last number used for each schema.
+        std::unordered_map<SerializableObject const*, int> _id_for_object;
+        std::unordered_map<std::string, int>               _next_id_for_type;
+
+        // Without it, the objects currently being written, outermost
+        // first, to catch cycles.
+        std::vector<SerializableObject const*> _objects_being_written;
 
         Writer*         _child_writer          = nullptr;
         CloningEncoder* _child_cloning_encoder = nullptr;
@@ -567,6 +623,178 @@ public:
         friend class SerializableObject;
     };
 
+    // Copies objects for clone() without serializing them.  A schema's
+    // _copy_to() hands the objects and containers it holds to copy(),
+    // which clones each object directly when its schema supports it and
+    // through the cloning encoder otherwise.
+    class Cloner
+    {
+    public:
+        template <typename T>
+        bool copy(Retainer<T> const& source, Retainer<T>* dest)
+        {
+            if (!source)
+            {
+                *dest = Retainer<T>();
+                return true;
+            }
+
+            Retainer<> clone(_clone(source.value));
+            if (!clone)
+            {
+                return false;
+            }
+
+            if (T* tclone = dynamic_cast<T*>(clone.value))
+            {
+                *dest = Retainer<T>(tclone);
+                return true;
+            }
+
+            error(ErrorStatus(
+                ErrorStatus::TYPE_MISMATCH,
+                "clone of " + source.value->schema_name()
+                    + " has a different type"));
+            return false;
+        }
+
+        template <typename T>
+        bool copy(
+            std::vector<Retainer<T>> const& source,
+            std::vector<Retainer<T>>*       dest)
+        {
+            std::vector<Retainer<T>> result(source.size());
+            for (size_t i = 0; i < source.size(); i++)
+            {
+                if (!copy(source[i], &result[i]))
+                {
+                    return false;
+                }
+            }
+            dest->swap(result);
+            return true;
+        }
+
+        template <typename T>
+        bool copy(
+            std::map<std::string, Retainer<T>> const& source,
+            std::map<std::string, Retainer<T>>*       dest)
+        {
+            std::map<std::string, Retainer<T>> result;
+            for (auto const& e: source)
+            {
+                if (!copy(e.second, &result[e.first]))
+                {
+                    return false;
+                }
+            }
+            dest->swap(result);
+            return true;
+        }
+
+        bool copy(AnyDictionary const& source, AnyDictionary* dest);
+        bool copy(AnyVector const& source, AnyVector* dest);
+        bool copy(std::any const& source, std::any* dest);
+
+        // True if copy() would reproduce source exactly and it holds no
+        // objects, so that a clone can share it instead of copying it.
+        bool can_share(AnyDictionary const& source) const;
+
+        void error(ErrorStatus const& error_status);
+
+        // A copy() that returns false without an error means something
+        // could not be copied directly, and the object holding it is cloned
+        // through the encoder instead.
+        bool has_errored() const { return is_error(_error_status); }
+
+    private:
+        Cloner() = default;
+
+        Cloner(Cloner const&)            = delete;
+        Cloner& operator=(Cloner const&) = delete;
+
+        SerializableObject* _clone(SerializableObject const* source);
+
+        ErrorStatus                            _error_status;
+        std::vector<SerializableObject const*> _objects_being_cloned;
+
+        friend class SerializableObject;
+    };
+
+    // Compares objects for is_equivalent_to() without serializing them.
+    // Both trees are walked together and the walk stops at the first
+    // difference.  Objects are compared as they would be written: a
+    // schema's _equals() hands the objects and containers it holds to
+    // equal(), which falls back to comparing the encoded forms for
+    // anything it cannot compare directly.
+    class Comparer
+    {
+    public:
+        template <typename T>
+        bool equal(Retainer<T> const& lhs, Retainer<T> const& rhs)
+        {
+            return _equal(lhs.value, rhs.value);
+        }
+
+        template <typename T>
+        bool equal(
+            std::vector<Retainer<T>> const& lhs,
+            std::vector<Retainer<T>> const& rhs)
+        {
+            if (lhs.size() != rhs.size())
+            {
+                return false;
+            }
+            for (size_t i = 0; i < lhs.size(); i++)
+            {
+                if (!_equal(lhs[i].value, rhs[i].value))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        template <typename T>
+        bool equal(
+            std::map<std::string, Retainer<T>> const& lhs,
+            std::map<std::string, Retainer<T>> const& rhs)
+        {
+            if (lhs.size() != rhs.size())
+            {
+                return false;
+            }
+            auto r = rhs.begin();
+            for (auto const& l: lhs)
+            {
+                if (l.first != r->first
+                    || !_equal(l.second.value, r->second.value))
+                {
+                    return false;
+                }
+                ++r;
+            }
+            return true;
+        }
+
+        bool equal(AnyDictionary const& lhs, AnyDictionary const& rhs);
+        bool equal(AnyVector const& lhs, AnyVector const& rhs);
+        bool equal(std::any const& lhs, std::any const& rhs);
+
+    private:
+        Comparer() = default;
+
+        Comparer(Comparer const&)            = delete;
+        Comparer& operator=(Comparer const&) = delete;
+
+        bool
+        _equal(SerializableObject const* lhs, SerializableObject const* rhs);
+
+        std::vector<SerializableObject const*> _objects_being_compared;
+
+        friend class SerializableObject;
+    };
+
     virtual bool read_from(Reader&);
     virtual void write_to(Writer&) const;
 
@@ -609,6 +837,25 @@ public:
             return *this;
         }
 
+        Retainer(Retainer&& rhs) noexcept
+            : value(rhs.value)
+        {
+            rhs.value = nullptr;
+        }
+
+        Retainer& operator=(Retainer&& rhs) noexcept
+        {
+            if (this != &rhs)
+            {
+                T* old_value = value;
+                value        = rhs.value;
+                rhs.value    = nullptr;
+                if (old_value)
+                    old_value->_managed_release();
+            }
+            return *this;
+        }
+
         ~Retainer()
         {
             if (value)
@@ -634,8 +881,32 @@ protected:
 
     virtual bool _is_deletable();
 
+    // Direct cloning and comparison.  A schema that supports them overrides
+    // _direct_class() to return its own type, _copy_to() to copy its fields
+    // into clone (which is a new object of the same type), and _equals()
+    // to compare its fields with those of other (which is of the same type
+    // too), each after handling the fields of its base class.  Objects of
+    // any other class, such as subclasses that do not do this themselves,
+    // are cloned and compared through serialization.
+    virtual std::type_info const& _direct_class() const;
+    virtual bool _copy_to(SerializableObject* clone, Cloner& cloner) const;
+    virtual bool
+    _equals(SerializableObject const& other, Comparer& comparer) const;
+
     virtual std::string _schema_name_for_reference() const;
 
+    // Record that this object holds held (as an effect, a media reference
+    // and so on), so that held can let it know when it changes.  An object
+    // can be held by several others.  One that stops holding it is still
+    // told about changes until it is destroyed.  Holding does not change
+    // this object, and may be recorded from several threads at once.
+    void _hold(SerializableObject const* held) const;
+
+    // Call fn with each object that took this one with _hold() and still
+    // exists.
+    template <typename Fn>
+    void _for_each_holder(Fn&& fn) const;
+
 private:
     SerializableObject(SerializableObject const&)            = delete;
     SerializableObject& operator=(SerializableObject const&) = delete;
@@ -666,7 +937,37 @@ public:
         std::string type_name;
     };
 
+    struct ContentHash
+    {
+        uint64_t high = 0;
+        uint64_t low  = 0;
+
+        // The digest as 32 hexadecimal digits.
+        std::string to_string() const;
+
+        friend bool operator==(ContentHash lhs, ContentHash rhs)
+        {
+            return lhs.high == rhs.high && lhs.low == rhs.low;
+        }
+
+        friend bool operator!=(ContentHash lhs, ContentHash rhs)
+        {
+            return !(lhs == rhs);
+        }
+    };
+
 private:
+    // Set *hash to the cached content hash, if it is up to date.
+    bool _cached_content_hash(ContentHash* hash) const;
+
+    // Cache hash as the content hash, until content_changed() is called.
+    void _cache_content_hash(ContentHash hash) const noexcept;
+
+    bool                _handled_directly() const;
+    SerializableObject* _clone_through_encoder(ErrorStatus* error_status) const;
+    static bool
+    _equivalent_through_encoder(std::any const& lhs, std::any const& rhs);
+
     void _set_type_record(TypeRegistry::_TypeRecord const* type_record)
     {
         _cached_type_record = type_record;
@@ -674,16 +975,48 @@ private:
 
     TypeRegistry::_TypeRecord const* _type_record() const;
 
-    mutable TypeRegistry::_TypeRecord const* _cached_type_record;
-    int                                      _managed_ref_count;
-    std::function<void()>                    _external_keepalive_monitor;
+    mutable std::atomic<TypeRegistry::_TypeRecord const*> _cached_type_record;
+    std::atomic<int>                                      _managed_ref_count;
 
-    mutable std::mutex _mutex;
+    // The monitor is installed at most once; the flag is set after it is,
+    // so that retain and release can test for it without locking.
+    std::function<void()> _external_keepalive_monitor;
+    std::atomic<bool>     _has_external_keepalive_monitor;
 
     AnyDictionary _dynamic_fields;
+
+    // Points at this object until it is destroyed; handed to the objects it
+    // holds, so that they can reach it without keeping it alive.
+    struct _HolderCell
+    {
+        std::atomic<SerializableObject*> object;
+    };
+
+    mutable std::shared_ptr<_HolderCell>              _holder_cell;
+    mutable std::vector<std::shared_ptr<_HolderCell>> _holders;
+
+    // The last content hash computed, valid until content_changed().
+    mutable std::atomic<uint64_t> _content_hash_high{ 0 };
+    mutable std::atomic<uint64_t> _content_hash_low{ 0 };
+    mutable std::atomic<bool>     _content_hash_valid{ false };
+
     friend class TypeRegistry;
+    friend class HashingEncoder;
 };
 
+template <typename Fn>
+inline void
+SerializableObject::_for_each_holder(Fn&& fn) const
+{
+    for (auto const& cell: _holders)
+    {
+        if (SerializableObject* holder = cell->object.load())
+        {
+            fn(holder);
+        }
+    }
+}
+
 template <class T, class U>
 SerializableObject::Retainer<T>
 dynamic_retainer_cast(SerializableObject::Retainer<U> const& retainer)
@@ -9,8 +9,12 @@ SerializableObjectWithMetadata::SerializableObjectWithMetadata(
     std::string const&   name,
     AnyDictionary const& metadata)
     : _name(name)
-    , _metadata(metadata)
-{}
+{
+    if (!metadata.empty())
+    {
+        _metadata = std::make_shared<AnyDictionary>(metadata);
+    }
+}
 
 SerializableObjectWithMetadata::~SerializableObjectWithMetadata()
 {}
@@ -18,8 +22,16 @@ SerializableObjectWithMetadata::~SerializableObjectWithMetadata()
 bool
 SerializableObjectWithMetadata::read_from(Reader& reader)
 {
-    return reader.read_if_present("metadata", &_metadata)
-           && reader.read_if_present("name", &_name)
+    AnyDictionary metadata;
+    if (!reader.read_if_present("metadata", &metadata))
+    {
+        return false;
+    }
+    if (!metadata.empty())
+    {
+        _mutable_metadata().swap(metadata);
+    }
+    return reader.read_if_present("name", &_name)
            && SerializableObject::read_from(reader);
 }
 
@@ -27,8 +39,73 @@ void
 SerializableObjectWithMetadata::write_to(Writer& writer) const
 {
     SerializableObject::write_to(writer);
-    writer.write("metadata", _metadata);
+    static const AnyDictionary empty_metadata;
+    writer.write("metadata", _metadata ? *_metadata : empty_metadata);
     writer.write("name", _name);
 }
 
+std::type_info const&
+SerializableObjectWithMetadata::_direct_class() const
+{
+    return typeid(SerializableObjectWithMetadata);
+}
+
+bool
+SerializableObjectWithMetadata::_copy_to(
+    SerializableObject* clone,
+    Cloner&             cloner) const
+{
+    auto c   = static_cast<SerializableObjectWithMetadata*>(clone);
+    c->_name = _name;
+    if (_metadata)
+    {
+        // metadata that may still be changed through a reference handed out
+        // earlier, or that holds objects of its own, is copied
+        if (!_metadata_exposed && cloner.can_share(*_metadata))
+        {
+            c->_metadata = _metadata;
+        }
+        else if (!cloner.copy(*_metadata, &c->_mutable_metadata()))
+        {
+            return false;
+        }
+    }
+    return Parent::_copy_to(clone, cloner);
+}
+
+bool
+SerializableObjectWithMetadata::_equals(
+    SerializableObject const& other,
+    Comparer&                 comparer) const
+{
+    auto const& o = static_cast<SerializableObjectWithMetadata const&>(other);
+    if (_name != o._name || !Parent::_equals(other, comparer))
+    {
+        return false;
+    }
+    if (_metadata == o._metadata)
+    {
+        return true;
+    }
+
+    static const AnyDictionary empty_metadata;
+    return comparer.equal(
+        _metadata ? *_metadata : empty_metadata,
+        o._metadata ? *o._metadata : empty_metadata);
+}
+
+AnyDictionary&
+SerializableObjectWithMetadata::_mutable_metadata()
+{
+    if (!_metadata)
+    {
+        _metadata = std::make_shared<AnyDictionary>();
+    }
+    else if (_metadata.use_count() > 1)
+    {
+        _metadata = std::make_shared<AnyDictionary>(*_metadata);
+    }
+    return *_metadata;
+}
+
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
@@ -3,9 +3,12 @@
 
 #pragma once
 
+#include "opentimelineio/internedString.h"
 #include "opentimelineio/serializableObject.h"
 #include "opentimelineio/version.h"
 
+#include <memory>
+
 namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
 
 class SerializableObjectWithMetadata : public SerializableObject
@@ -25,11 +28,27 @@ public:
 
     std::string name() const noexcept { return _name; }
 
-    void set_name(std::string const& name) { _name = name; }
+    void set_name(std::string const& name)
+    {
+        _name = name;
+        content_changed();
+    }
 
-    AnyDictionary& metadata() noexcept { return _metadata; }
+    // Clones share the metadata of the object they were cloned from until
+    // either of them changes it.  The reference returned here may be kept
+    // and written through at any time, so once it has been handed out the
+    // object stops sharing its metadata with later clones.
+    AnyDictionary& metadata()
+    {
+        content_changed();
+        _metadata_exposed = true;
+        return _mutable_metadata();
+    }
 
-    AnyDictionary metadata() const noexcept { return _metadata; }
+    AnyDictionary metadata() const noexcept
+    {
+        return _metadata ? *_metadata : AnyDictionary();
+    }
 
 protected:
     virtual ~SerializableObjectWithMetadata();
@@ -37,9 +56,21 @@ protected:
     bool read_from(Reader&) override;
     void write_to(Writer&) const override;
 
+    std::type_info const& _direct_class() const override;
+    bool _copy_to(SerializableObject* clone, Cloner&) const override;
+    bool _equals(SerializableObject const& other, Comparer&) const override;
+
 private:
-    std::string   _name;
-    AnyDictionary _metadata;
+    AnyDictionary& _mutable_metadata();
+
+    InternedString _name;
+
+    // null while the metadata is empty; otherwise possibly shared with
+    // clones, and copied before it is changed
+    std::shared_ptr<AnyDictionary> _metadata;
+    bool                           _metadata_exposed = false;
+
+    friend class JSONDecoder;
 };
 
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
@@ -4,6 +4,7 @@
 #include "opentimelineio/serialization.h"
 #include "errorStatus.h"
 #include "opentimelineio/anyDictionary.h"
+#include "opentimelineio/safely_typed_any.h"
 #include "opentimelineio/serializableObject.h"
 #include "opentimelineio/unknownSchema.h"
 #include "stringUtils.h"
@@ -11,12 +12,16 @@
 #include <string>
 
 #define RAPIDJSON_NAMESPACE OTIO_rapidjson
-#include <rapidjson/ostreamwrapper.h>
+#include <rapidjson/filewritestream.h>
 #include <rapidjson/prettywriter.h>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 
-#include <fstream>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <vector>
 
 #if defined(_WINDOWS)
 #    ifndef WIN32_LEAN_AND_MEAN
@@ -78,6 +83,19 @@ public:
     virtual void write_value(struct SerializableObject::ReferenceId) = 0;
     virtual void write_value(IMATH_NAMESPACE::Box2d const&)          = 0;
 
+    // Called by the Writer around each object.  An encoder that keeps
+    // something per object can write the object itself in one step by
+    // returning true from write_cached_object(), in which case its contents
+    // are not written.  holder is the object being written that the object
+    // is written within, if any.
+    virtual bool write_cached_object(
+        SerializableObject const* /* value */,
+        SerializableObject const* /* holder */)
+    {
+        return false;
+    }
+    virtual void object_written(SerializableObject const*) {}
+
 protected:
     void _error(ErrorStatus const& error_status)
     {
@@ -264,6 +282,7 @@ public:
         }
         else
         {
+            _resolver.reference_count++;
             _store(std::any(value));
         }
         _store(std::any(value));
@@ -323,6 +342,7 @@ public:
         }
 
         _stack.emplace_back(_DictOrArray{ true /* is_dict*/ });
+        _stack.back().reference_count = _resolver.reference_count;
     }
 
     void end_array() override
@@ -386,12 +406,14 @@ public:
         if (_result_object_policy
             == ResultObjectPolicy::CloneBackToSerializableObject)
         {
+            const bool has_references =
+                _resolver.reference_count != top.reference_count;
             SerializableObject::Reader reader(
                 top.dict,
                 _error_function,
                 nullptr);
             _stack.pop_back();
-            _store(reader._decode(_resolver));
+            _store(reader._decode(_resolver, has_references));
 
             return;
         }
@@ -421,6 +443,9 @@ private:
         AnyDictionary dict;
         AnyVector     array;
         std::string   cur_key;
+
+        // The resolver's reference count when the object started.
+        size_t reference_count = 0;
     };
 
     void _internal_error(std::string const& err_msg)
@@ -635,6 +660,264 @@ private:
     RapidJSONWriterType& _writer;
 };
 
+/**
+ * This encoder computes the content hash of an object.  Every object,
+ * dictionary and array is digested on its own from the values written into
+ * it, and its digest is then fed to the one that holds it, so the digest of
+ * an object that has not changed since it was last hashed can be reused
+ * from its cache without writing it again.
+ *
+ * Values are fed in as 64 bit words, so the result does not depend on the
+ * byte order or word size of the platform.
+ */
+class HashingEncoder : public Encoder
+{
+public:
+    HashingEncoder() { _stack.emplace_back(0); }
+
+    SerializableObject::ContentHash result() const { return _last; }
+
+    void start_object() override { _stack.emplace_back(_object_seed); }
+
+    void end_object() override { _end(_object_tag); }
+
+    void start_array(size_t) override { _stack.emplace_back(_array_seed); }
+
+    void end_array() override { _end(_array_tag); }
+
+    void write_key(std::string const& key) override
+    {
+        _write(_key_tag, key);
+    }
+
+    void write_null_value() override { _feed(_null_tag); }
+
+    void write_value(bool value) override
+    {
+        _feed(_bool_tag);
+        _feed(value ? 1 : 0);
+    }
+
+    void write_value(int value) override
+    {
+        write_value(static_cast<int64_t>(value));
+    }
+
+    void write_value(int64_t value) override
+    {
+        _feed(_integer_tag);
+        _feed(static_cast<uint64_t>(value));
+    }
+
+    void write_value(uint64_t value) override
+    {
+        _feed(value > uint64_t(INT64_MAX) ? _unsigned_tag : _integer_tag);
+        _feed(value);
+    }
+
+    void write_value(double value) override
+    {
+        _feed(_double_tag);
+        _feed(_bits(value));
+    }
+
+    void write_value(std::string const& value) override
+    {
+        _write(_string_tag, value);
+    }
+
+    void write_value(RationalTime const& value) override
+    {
+        _feed(_rational_time_tag);
+        _feed(_bits(value.value()));
+        _feed(_bits(value.rate()));
+    }
+
+    void write_value(TimeRange const& value) override
+    {
+        _feed(_time_range_tag);
+        _feed(_bits(value.start_time().value()));
+        _feed(_bits(value.start_time().rate()));
+        _feed(_bits(value.duration().value()));
+        _feed(_bits(value.duration().rate()));
+    }
+
+    void write_value(TimeTransform const& value) override
+    {
+        _feed(_time_transform_tag);
+        _feed(_bits(value.offset().value()));
+        _feed(_bits(value.offset().rate()));
+        _feed(_bits(value.scale()));
+        _feed(_bits(value.rate()));
+    }
+
+    void write_value(SerializableObject::ReferenceId value) override
+    {
+        _write(_reference_id_tag, value.id);
+    }
+
+    void write_value(IMATH_NAMESPACE::Box2d const& value) override
+    {
+        _feed(_box2d_tag);
+        _feed(_bits(value.min.x));
+        _feed(_bits(value.min.y));
+        _feed(_bits(value.max.x));
+        _feed(_bits(value.max.y));
+    }
+
+    bool write_cached_object(
+        SerializableObject const* value,
+        SerializableObject const* holder) override
+    {
+        // the digest of holder now depends on value, so value must tell it
+        // when it changes
+        if (holder)
+        {
+            holder->_hold(value);
+        }
+
+        SerializableObject::ContentHash hash;
+        if (!value->_cached_content_hash(&hash))
+        {
+            return false;
+        }
+
+        _feed_hash(_object_tag, hash);
+        _last = hash;
+        return true;
+    }
+
+    void object_written(SerializableObject const* value) override
+    {
+        if (!has_errored())
+        {
+            value->_cache_content_hash(_last);
+        }
+    }
+
+private:
+    // The state of one digest, as two 64 bit lanes.
+    struct _State
+    {
+        explicit _State(uint64_t seed)
+            : a(seed ^ 0x9e3779b97f4a7c15ULL)
+            , b(seed ^ 0xc2b2ae3d27d4eb4fULL)
+        {}
+
+        uint64_t a;
+        uint64_t b;
+        uint64_t length = 0;
+    };
+
+    static constexpr uint64_t _object_seed = 0x6f626a6563740000ULL;
+    static constexpr uint64_t _array_seed  = 0x6172726179000000ULL;
+
+    enum : uint64_t
+    {
+        _null_tag = 1,
+        _bool_tag,
+        _integer_tag,
+        _unsigned_tag,
+        _double_tag,
+        _string_tag,
+        _key_tag,
+        _rational_time_tag,
+        _time_range_tag,
+        _time_transform_tag,
+        _reference_id_tag,
+        _box2d_tag,
+        _object_tag,
+        _array_tag
+    };
+
+    static uint64_t _rotl(uint64_t x, int r)
+    {
+        return (x << r) | (x >> (64 - r));
+    }
+
+    // the 64 bit finalizer of MurmurHash3
+    static uint64_t _mix(uint64_t k)
+    {
+        k ^= k >> 33;
+        k *= 0xff51afd7ed558ccdULL;
+        k ^= k >> 33;
+        k *= 0xc4ceb9fe1a85ec53ULL;
+        k ^= k >> 33;
+        return k;
+    }
+
+    static uint64_t _bits(double value)
+    {
+        uint64_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    void _feed(uint64_t word)
+    {
+        _State& s = _stack.back();
+        s.a       = _rotl(s.a ^ _mix(word), 27) * 0x87c37b91114253d5ULL;
+        s.b       = _rotl(s.b + word, 31) * 0x4cf5ad432745937fULL + s.a;
+        s.length++;
+    }
+
+    void _feed_hash(uint64_t tag, SerializableObject::ContentHash hash)
+    {
+        _feed(tag);
+        _feed(hash.high);
+        _feed(hash.low);
+    }
+
+    void _write(uint64_t tag, std::string const& value)
+    {
+        _feed(tag);
+        _feed(value.size());
+
+        // eight bytes at a time, in little endian order
+        auto const*  bytes =
+            reinterpret_cast<unsigned char const*>(value.data());
+        const size_t size  = value.size();
+        for (size_t i = 0; i < size; i += 8)
+        {
+            uint64_t word = 0;
+            for (size_t j = 0; j < 8 && i + j < size; j++)
+            {
+                word |= uint64_t(bytes[i + j]) << (8 * j);
+            }
+            _feed(word);
+        }
+    }
+
+    void _end(uint64_t tag)
+    {
+        if (_stack.size() < 2)
+        {
+            _error(ErrorStatus(
+                ErrorStatus::INTERNAL_ERROR,
+                "HashingEncoder: container ended without being started"));
+            return;
+        }
+
+        _State s = _stack.back();
+        _stack.pop_back();
+
+        uint64_t a = s.a ^ s.length;
+        uint64_t b = s.b ^ s.length;
+        a += b;
+        b += a;
+        a = _mix(a);
+        b = _mix(b);
+        a += b;
+        b += a;
+
+        _last = SerializableObject::ContentHash{ a, b };
+        _feed_hash(tag, _last);
+    }
+
+    std::vector<_State>             _stack;
+    SerializableObject::ContentHash _last;
+};
+
 template <typename T>
 bool
 _simple_any_comparison(std::any const& lhs, std::any const& rhs)
@@ -661,105 +944,6 @@ _simple_any_comparison<char const*>(std::any const& lhs, std::any const& rhs)
                std::any_cast<char const*>(rhs));
 }
 
-void
-SerializableObject::Writer::_build_dispatch_tables()
-{
-    /*
-     * These are basically atomic writes to the encoder:
-     */
-
-    auto& wt          = _write_dispatch_table;
-    wt[&typeid(void)] = [this](std::any const&) {
-        _encoder.write_null_value();
-    };
-    wt[&typeid(bool)] = [this](std::any const& value) {
-        _encoder.write_value(std::any_cast<bool>(value));
-    };
-    wt[&typeid(int64_t)] = [this](std::any const& value) {
-        _encoder.write_value(std::any_cast<int64_t>(value));
-    };
-    wt[&typeid(double)] = [this](std::any const& value) {
-        _encoder.write_value(std::any_cast<double>(value));
-    };
-    wt[&typeid(std::string)] = [this](std::any const& value) {
-        _encoder.write_value(std::any_cast<std::string const&>(value));
-    };
-    wt[&typeid(char const*)] = [this](std::any const& value) {
-        _encoder.write_value(std::string(std::any_cast<char const*>(value)));
-    };
-    wt[&typeid(RationalTime)] = [this](std::any const& value) {
-        _encoder.write_value(std::any_cast<RationalTime const&>(value));
-    };
-    wt[&typeid(TimeRange)] = [this](std::any const& value) {
-        _encoder.write_value(std::any_cast<TimeRange const&>(value));
-    };
-    wt[&typeid(TimeTransform)] = [this](std::any const& value) {
-        _encoder.write_value(std::any_cast<TimeTransform const&>(value));
-    };
-    wt[&typeid(IMATH_NAMESPACE::V2d)] = [this](std::any const& value) {
-        _encoder.write_value(std::any_cast<IMATH_NAMESPACE::V2d const&>(value));
-    };
-    wt[&typeid(IMATH_NAMESPACE::Box2d)] = [this](std::any const& value) {
-        _encoder.write_value(
-            std::any_cast<IMATH_NAMESPACE::Box2d const&>(value));
-    };
-
-    /*
-     * These next recurse back through the Writer itself:
-     */
-    wt[&typeid(SerializableObject::Retainer<>)] =
-        [this](std::any const& value) {
-            this->write(
-                _no_key,
-                std::any_cast<SerializableObject::Retainer<>>(value));
-        };
-
-    wt[&typeid(AnyDictionary)] = [this](std::any const& value) {
-        this->write(_no_key, std::any_cast<AnyDictionary const&>(value));
-    };
-
-    wt[&typeid(AnyVector)] = [this](std::any const& value) {
-        this->write(_no_key, std::any_cast<AnyVector const&>(value));
-    };
-
-    /*
-     * Install a backup table, using the actual type name as a key.
-     * This is to deal with type aliasing across compilation units.
-     */
-    for (const auto& e: wt)
-    {
-        _write_dispatch_table_by_name[e.first->name()] = e.second;
-    }
-
-    auto& et                   = _equality_dispatch_table;
-    et[&typeid(void)]          = &_simple_any_comparison<void>;
-    et[&typeid(bool)]          = &_simple_any_comparison<bool>;
-    et[&typeid(int64_t)]       = &_simple_any_comparison<int64_t>;
-    et[&typeid(double)]        = &_simple_any_comparison<double>;
-    et[&typeid(std::string)]   = &_simple_any_comparison<std::string>;
-    et[&typeid(char const*)]   = &_simple_any_comparison<char const*>;
-    et[&typeid(RationalTime)]  = &_simple_any_comparison<RationalTime>;
-    et[&typeid(TimeRange)]     = &_simple_any_comparison<TimeRange>;
-    et[&typeid(TimeTransform)] = &_simple_any_comparison<TimeTransform>;
-    et[&typeid(SerializableObject::ReferenceId)] =
-        &_simple_any_comparison<SerializableObject::ReferenceId>;
-    et[&typeid(IMATH_NAMESPACE::V2d)] =
-        &_simple_any_comparison<IMATH_NAMESPACE::V2d>;
-    et[&typeid(IMATH_NAMESPACE::Box2d)] =
-        &_simple_any_comparison<IMATH_NAMESPACE::Box2d>;
-
-    /*
-     * These next recurse back through the Writer itself:
-     */
-    et[&typeid(AnyDictionary)] =
-        [this](std::any const& lhs, std::any const& rhs) {
-            return _any_dict_equals(lhs, rhs);
-        };
-    et[&typeid(AnyVector)] = [this](std::any const& lhs, std::any const& rhs) {
-        return _any_array_equals(lhs, rhs);
-    };
-}
-
 bool
 SerializableObject::Writer::_any_dict_equals(
     std::any const& lhs,
@@ -827,8 +1011,53 @@ SerializableObject::Writer::_any_equals(
     std::any const& lhs,
     std::any const& rhs)
 {
-    auto e = _equality_dispatch_table.find(&lhs.type());
-    return (e != _equality_dispatch_table.end()) && e->second(lhs, rhs);
+    const AnyKind kind = safely_typed_any_kind(lhs);
+    if (kind != safely_typed_any_kind(rhs))
+    {
+        return false;
+    }
+
+    switch (kind)
+    {
+        case AnyKind::null_value:
+            return true;
+        case AnyKind::bool_value:
+            return _simple_any_comparison<bool>(lhs, rhs);
+        case AnyKind::int64_value:
+            return _simple_any_comparison<int64_t>(lhs, rhs);
+        case AnyKind::double_value:
+            return _simple_any_comparison<double>(lhs, rhs);
+        case AnyKind::string_value:
+            return _simple_any_comparison<std::string>(lhs, rhs);
+        case AnyKind::c_string_value:
+            return _simple_any_comparison<char const*>(lhs, rhs);
+        case AnyKind::rational_time_value:
+            return _simple_any_comparison<RationalTime>(lhs, rhs);
+        case AnyKind::time_range_value:
+            return _simple_any_comparison<TimeRange>(lhs, rhs);
+        case AnyKind::time_transform_value:
+            return _simple_any_comparison<TimeTransform>(lhs, rhs);
+        case AnyKind::point_value:
+            return _simple_any_comparison<IMATH_NAMESPACE::V2d>(lhs, rhs);
+        case AnyKind::box_value:
+            return _simple_any_comparison<IMATH_NAMESPACE::Box2d>(lhs, rhs);
+        case AnyKind::reference_id_value:
+            return _simple_any_comparison<SerializableObject::ReferenceId>(
+                lhs,
+                rhs);
+        case AnyKind::dictionary_value:
+            return _any_dict_equals(lhs, rhs);
+        case AnyKind::vector_value:
+            return _any_array_equals(lhs, rhs);
+
+        // the encoder never produces these
+        case AnyKind::int_value:
+        case AnyKind::uint64_value:
+        case AnyKind::object_value:
+        case AnyKind::other:
+            break;
+    }
+    return false;
 }
 
 bool
@@ -942,43 +1171,51 @@ SerializableObject::Writer::write(
         return;
     }
 
+#ifdef OTIO_INSTANCING_SUPPORT
+    std::string const schema_type_name = value->_schema_name_for_reference();
+
     auto e = _id_for_object.find(value);
     if (e != _id_for_object.end())
     {
-#ifdef OTIO_INSTANCING_SUPPORT
         /*
          * We've already written this value.
          */
-        _encoder.write_value(SerializableObject::ReferenceId{ e->second });
-#else
-        /*
-         * We're encountering the same object while it is still
-         * in the map, meaning we're in the middle of writing it out.
-         * That's a cycle, as opposed to mere instancing, which we
-         * allow so as not to break old allowed behavior.
-         */
-        std::string s = string_printf(
-            "cyclically encountered object has schema %s",
-            value->schema_name().c_str());
-        _encoder._error(ErrorStatus(ErrorStatus::OBJECT_CYCLE, s));
-#endif
+        _encoder.write_value(SerializableObject::ReferenceId{
+            schema_type_name + "-" + std::to_string(e->second) });
         return;
     }
 
-    std::string const& schema_type_name = value->_schema_name_for_reference();
-    if (_next_id_for_type.find(schema_type_name) == _next_id_for_type.end())
+    const int next_id = ++_next_id_for_type[schema_type_name];
+    _id_for_object.emplace(value, next_id);
+#else
+    if (_encoder.write_cached_object(
+            value,
+            _objects_being_written.empty() ? nullptr
+                                           : _objects_being_written.back()))
     {
-        _next_id_for_type[schema_type_name] = 0;
+        return;
     }
 
-    std::string next_id =
-        schema_type_name + "-"
-        + std::to_string(++_next_id_for_type[schema_type_name]);
-    _id_for_object[value] = next_id;
+    /*
+     * Encountering an object that is still being written means we're in the
+     * middle of writing it out.  That's a cycle, as opposed to mere
+     * instancing, which we allow so as not to break old allowed behavior.
+     */
+    for (auto ancestor: _objects_being_written)
+    {
+        if (ancestor == value)
+        {
+            std::string s = string_printf(
+                "cyclically encountered object has schema %s",
+                value->schema_name().c_str());
+            _encoder._error(ErrorStatus(ErrorStatus::OBJECT_CYCLE, s));
+            return;
+        }
+    }
+    _objects_being_written.push_back(value);
+#endif
 
-    // detect if downgrading needs to happen
-    const std::string& schema_name    = value->schema_name();
-    int                schema_version = value->schema_version();
+    TypeRegistry::_TypeRecord const* type_record = value->_type_record();
 
     std::any downgraded = {};
 
@@ -987,8 +1224,9 @@ SerializableObject::Writer::write(
         && (!_downgrade_version_manifest->empty())
         && (!_encoder.encoding_to_anydict()))
     {
+        // detect if downgrading needs to happen
         const auto& target_version_it =
-            _downgrade_version_manifest->find(schema_name);
+            _downgrade_version_manifest->find(type_record->schema_name);
 
         // ...and if that downgrade manifest specifies a target version for
         // this schema
@@ -998,7 +1236,7 @@ SerializableObject::Writer::write(
                 static_cast<int>(target_version_it->second);
 
             // and the current_version is greater than the target version
-            if (schema_version > target_version)
+            if (type_record->schema_version > target_version)
             {
                 if (_child_writer == nullptr)
                 {
@@ -1017,36 +1255,22 @@ SerializableObject::Writer::write(
                 if (_child_cloning_encoder->has_errored(
                         &_encoder._error_status))
                 {
+#ifndef OTIO_INSTANCING_SUPPORT
+                    _objects_being_written.pop_back();
+#endif
                     return;
                 }
 
                 downgraded.swap(_child_cloning_encoder->_root);
-                schema_version = target_version;
             }
         }
     }
 
-    std::string schema_str = "";
-
-    // if its an unknown schema, the schema name is computed from the
-    // _original_schema_name and _original_schema_version attributes
-    if (UnknownSchema const* us = dynamic_cast<UnknownSchema const*>(value))
-    {
-        schema_str =
-            (us->_original_schema_name + "."
-             + std::to_string(us->_original_schema_version));
-    }
-    else
-    {
-        // otherwise, use the schema_name and schema_version attributes
-        schema_str = schema_name + "." + std::to_string(schema_version);
-    }
-
     _encoder.start_object();
 
 #ifdef OTIO_INSTANCING_SUPPORT
     _encoder.write_key("OTIO_REF_ID");
-    _encoder.write_value(next_id);
+    _encoder.write_value(schema_type_name + "-" + std::to_string(next_id));
 #endif
 
     // write the contents of the object to the encoder, either the downgraded
@@ -1061,18 +1285,31 @@ SerializableObject::Writer::write(
     else
     {
         _encoder.write_key("OTIO_SCHEMA");
-        _encoder.write_value(schema_str);
+
+        // if its an unknown schema, the schema name is computed from the
+        // _original_schema_name and _original_schema_version attributes
+        if (value->is_unknown_schema())
+        {
+            UnknownSchema const* us = static_cast<UnknownSchema const*>(value);
+            _encoder.write_value(
+                us->_original_schema_name + "."
+                + std::to_string(us->_original_schema_version));
+        }
+        else
+        {
+            // otherwise, use the label of the schema_name and schema_version
+            _encoder.write_value(type_record->schema_label);
+        }
         value->write_to(*this);
     }
 
     _encoder.end_object();
 
 #ifndef OTIO_INSTANCING_SUPPORT
-    auto valueEntry = _id_for_object.find(value);
-    if (valueEntry != _id_for_object.end())
-    {
-        _id_for_object.erase(valueEntry);
-    }
+    // with instancing, how an object is written depends on what was written
+    // before it, so there is nothing to keep per object
+    _encoder.object_written(value);
+    _objects_being_written.pop_back();
 #endif
 }
 
@@ -1131,70 +1368,167 @@ SerializableObject::Writer::write(
 void
 SerializableObject::Writer::write(std::string const& key, std::any const& value)
 {
-    std::type_info const& type = value.type();
-
     _encoder_write_key(key);
 
-    auto e = _write_dispatch_table.find(&type);
-    if (e == _write_dispatch_table.end())
+    switch (safely_typed_any_kind(value))
     {
+        case AnyKind::null_value:
+            _encoder.write_null_value();
+            return;
+        case AnyKind::bool_value:
+            _encoder.write_value(std::any_cast<bool>(value));
+            return;
+        case AnyKind::int64_value:
+            _encoder.write_value(std::any_cast<int64_t>(value));
+            return;
+        case AnyKind::double_value:
+            _encoder.write_value(std::any_cast<double>(value));
+            return;
+        case AnyKind::string_value:
+            _encoder.write_value(std::any_cast<std::string const&>(value));
+            return;
+        case AnyKind::c_string_value:
+            _encoder.write_value(
+                std::string(std::any_cast<char const*>(value)));
+            return;
+        case AnyKind::rational_time_value:
+            _encoder.write_value(std::any_cast<RationalTime const&>(value));
+            return;
+        case AnyKind::time_range_value:
+            _encoder.write_value(std::any_cast<TimeRange const&>(value));
+            return;
+        case AnyKind::time_transform_value:
+            _encoder.write_value(std::any_cast<TimeTransform const&>(value));
+            return;
+        case AnyKind::point_value:
+            _encoder.write_value(
+                std::any_cast<IMATH_NAMESPACE::V2d const&>(value));
+            return;
+        case AnyKind::box_value:
+            _encoder.write_value(
+                std::any_cast<IMATH_NAMESPACE::Box2d const&>(value));
+            return;
+
         /*
-         * Using the address of a type_info suffers from aliasing across
-         * compilation units. If we fail on a lookup, we fallback on the
-         * by_name table, but that's slow because we have to keep making a
-         * string each time.
-         *
-         * So when we fail, we insert the address of the type_info that failed
-         * to be found, so that we'll catch it the next time.  This ensures we
-         * fail exactly once per alias per type while using this writer.
+         * These next recurse back through the Writer itself:
          */
-        const auto& backup_e = _write_dispatch_table_by_name.find(type.name());
-        if (backup_e != _write_dispatch_table_by_name.end())
-        {
-            e = _write_dispatch_table.insert({ &type, backup_e->second }).first;
-        }
+        case AnyKind::object_value:
+            write(_no_key, std::any_cast<Retainer<> const&>(value));
+            return;
+        case AnyKind::dictionary_value:
+            write(_no_key, std::any_cast<AnyDictionary const&>(value));
+            return;
+        case AnyKind::vector_value:
+            write(_no_key, std::any_cast<AnyVector const&>(value));
+            return;
+
+        // these cannot be written
+        case AnyKind::int_value:
+        case AnyKind::uint64_value:
+        case AnyKind::reference_id_value:
+        case AnyKind::other:
+            break;
     }
 
-    if (e != _write_dispatch_table.end())
+    std::type_info const& type = value.type();
+    std::string           bad_type_name =
+        (type == typeid(UnknownType))
+            ? type_name_for_error_message(
+                  std::any_cast<UnknownType>(value).type_name)
+            : type_name_for_error_message(type);
+
+    std::string s;
+    if (&key != &_no_key)
     {
-        e->second(value);
+        s = string_printf(
+            "Encountered object of unknown type '%s' under key '%s'",
+            bad_type_name.c_str(),
+            key.c_str());
     }
     else
     {
-        std::string s;
-        std::string bad_type_name =
-            (type == typeid(UnknownType))
-                ? type_name_for_error_message(
-                      std::any_cast<UnknownType>(value).type_name)
-                : type_name_for_error_message(type);
+        s = string_printf(
+            "Encountered object of unknown type '%s'",
+            bad_type_name.c_str());
+    }
 
-        if (&key != &_no_key)
-        {
-            s = string_printf(
-                "Encountered object of unknown type '%s' under key '%s'",
-                bad_type_name.c_str(),
-                key.c_str());
-        }
-        else
-        {
-            s = string_printf(
-                "Encountered object of unknown type '%s'",
-                bad_type_name.c_str());
-        }
+    _encoder._error(ErrorStatus(ErrorStatus::TYPE_MISMATCH, s));
+    _encoder.write_null_value();
+}
 
-        _encoder._error(ErrorStatus(ErrorStatus::TYPE_MISMATCH, s));
-        _encoder.write_null_value();
+bool
+SerializableObject::is_equivalent_to(SerializableObject const& other) const
+{
+    Comparer comparer;
+    return comparer._equal(this, &other);
+}
+
+SerializableObject::ContentHash
+SerializableObject::content_hash(ErrorStatus* error_status) const
+{
+    ContentHash hash;
+    if (_cached_content_hash(&hash))
+    {
+        return hash;
     }
+
+    HashingEncoder             e;
+    SerializableObject::Writer w(e, {});
+    w.write(w._no_key, this);
+    return e.has_errored(error_status) ? ContentHash() : e.result();
+}
+
+void
+SerializableObject::content_changed() noexcept
+{
+    // a holder whose digest is already out of date was told when this one's
+    // went out of date, and has not been hashed since without rehashing this
+    if (!_content_hash_valid.exchange(false, std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    _for_each_holder(
+        [](SerializableObject* holder) { holder->content_changed(); });
 }
 
 bool
-SerializableObject::is_equivalent_to(SerializableObject const& other) const
+SerializableObject::_cached_content_hash(ContentHash* hash) const
 {
-    if (_type_record() != other._type_record())
+    if (!_content_hash_valid.load(std::memory_order_acquire))
     {
         return false;
     }
 
+    hash->high = _content_hash_high.load(std::memory_order_relaxed);
+    hash->low  = _content_hash_low.load(std::memory_order_relaxed);
+    return true;
+}
+
+void
+SerializableObject::_cache_content_hash(ContentHash hash) const noexcept
+{
+    // threads hashing the same unchanged object at once compute the same
+    // digest, so they may all store it
+    _content_hash_high.store(hash.high, std::memory_order_relaxed);
+    _content_hash_low.store(hash.low, std::memory_order_relaxed);
+    _content_hash_valid.store(true, std::memory_order_release);
+}
+
+std::string
+SerializableObject::ContentHash::to_string() const
+{
+    return string_printf(
+        "%016llx%016llx",
+        static_cast<unsigned long long>(high),
+        static_cast<unsigned long long>(low));
+}
+
+bool
+SerializableObject::_equivalent_through_encoder(
+    std::any const& lhs,
+    std::any const& rhs)
+{
     const auto policy = (CloningEncoder::ResultObjectPolicy::
                              MathTypesConcreteAnyDictionaryResult);
 
@@ -1202,8 +1536,8 @@ SerializableObject::is_equivalent_to(SerializableObject const& other) const
     SerializableObject::Writer w1(e1, {});
     SerializableObject::Writer w2(e2, {});
 
-    w1.write(w1._no_key, std::any(Retainer<>(this)));
-    w2.write(w2._no_key, std::any(Retainer<>(&other)));
+    w1.write(w1._no_key, lhs);
+    w2.write(w2._no_key, rhs);
 
     return (
         !e1.has_errored() && !e2.has_errored()
@@ -1212,6 +1546,18 @@ SerializableObject::is_equivalent_to(SerializableObject const& other) const
 
 SerializableObject*
 SerializableObject::clone(ErrorStatus* error_status) const
+{
+    Cloner              cloner;
+    SerializableObject* result = cloner._clone(this);
+    if (error_status)
+    {
+        *error_status = cloner._error_status;
+    }
+    return result;
+}
+
+SerializableObject*
+SerializableObject::_clone_through_encoder(ErrorStatus* error_status) const
 {
     CloningEncoder e(
         CloningEncoder::ResultObjectPolicy::CloneBackToSerializableObject);
@@ -1239,6 +1585,378 @@ SerializableObject::clone(ErrorStatus* error_status) const
                : nullptr;
 }
 
+std::type_info const&
+SerializableObject::_direct_class() const
+{
+    return typeid(SerializableObject);
+}
+
+bool
+SerializableObject::_copy_to(SerializableObject* clone, Cloner& cloner) const
+{
+    return cloner.copy(_dynamic_fields, &clone->_dynamic_fields);
+}
+
+bool
+SerializableObject::_equals(
+    SerializableObject const& other,
+    Comparer&                 comparer) const
+{
+    return comparer.equal(_dynamic_fields, other._dynamic_fields);
+}
+
+bool
+SerializableObject::_handled_directly() const
+{
+#ifdef OTIO_INSTANCING_SUPPORT
+    // shared objects are written as references, which only the encoder
+    // reproduces
+    return false;
+#else
+    // only a class that handles its own fields, registered as the class of
+    // the object's schema, can be handled directly
+    auto type_record = _type_record();
+    return type_record->type && *type_record->type == typeid(*this)
+           && _direct_class() == typeid(*this);
+#endif
+}
+
+SerializableObject*
+SerializableObject::Cloner::_clone(SerializableObject const* source)
+{
+    for (auto ancestor: _objects_being_cloned)
+    {
+        if (ancestor == source)
+        {
+            error(ErrorStatus(
+                ErrorStatus::OBJECT_CYCLE,
+                string_printf(
+                    "cyclically encountered object has schema %s",
+                    source->schema_name().c_str())));
+            return nullptr;
+        }
+    }
+
+    if (source->_handled_directly())
+    {
+        Retainer<> clone(source->_type_record()->create_object());
+        _objects_being_cloned.push_back(source);
+        const bool copied = source->_copy_to(clone, *this);
+        _objects_being_cloned.pop_back();
+        if (copied)
+        {
+            return clone.take_value();
+        }
+        if (has_errored())
+        {
+            return nullptr;
+        }
+    }
+
+    return source->_clone_through_encoder(&_error_status);
+}
+
+bool
+SerializableObject::Cloner::copy(
+    AnyDictionary const& source,
+    AnyDictionary*       dest)
+{
+    // the encoder would turn a dictionary that names a schema into an object
+    if (source.find("OTIO_SCHEMA") != source.end())
+    {
+        return false;
+    }
+
+    AnyDictionary result;
+    for (auto const& e: source)
+    {
+        std::any value;
+        if (!copy(e.second, &value))
+        {
+            return false;
+        }
+        result.emplace_hint(result.end(), e.first, std::move(value));
+    }
+    dest->swap(result);
+    return true;
+}
+
+bool
+SerializableObject::Cloner::copy(AnyVector const& source, AnyVector* dest)
+{
+    AnyVector result(source.size());
+    for (size_t i = 0; i < source.size(); i++)
+    {
+        if (!copy(source[i], &result[i]))
+        {
+            return false;
+        }
+    }
+    dest->swap(result);
+    return true;
+}
+
+bool
+SerializableObject::Cloner::copy(std::any const& source, std::any* dest)
+{
+    switch (safely_typed_any_kind(source))
+    {
+        case AnyKind::dictionary_value: {
+            AnyDictionary result;
+            if (!copy(std::any_cast<AnyDictionary const&>(source), &result))
+            {
+                return false;
+            }
+            *dest = std::any(std::move(result));
+            return true;
+        }
+        case AnyKind::vector_value: {
+            AnyVector result;
+            if (!copy(std::any_cast<AnyVector const&>(source), &result))
+            {
+                return false;
+            }
+            *dest = std::any(std::move(result));
+            return true;
+        }
+        case AnyKind::object_value: {
+            Retainer<> result;
+            if (!copy(std::any_cast<Retainer<> const&>(source), &result))
+            {
+                return false;
+            }
+            *dest = std::any(std::move(result));
+            return true;
+        }
+        case AnyKind::c_string_value:
+            *dest = std::any(std::string(std::any_cast<char const*>(source)));
+            return true;
+        case AnyKind::null_value:
+        case AnyKind::bool_value:
+        case AnyKind::int64_value:
+        case AnyKind::double_value:
+        case AnyKind::string_value:
+        case AnyKind::rational_time_value:
+        case AnyKind::time_range_value:
+        case AnyKind::time_transform_value:
+        case AnyKind::point_value:
+        case AnyKind::box_value:
+            *dest = source;
+            return true;
+
+        // anything else is left for the writer to handle or report
+        case AnyKind::int_value:
+        case AnyKind::uint64_value:
+        case AnyKind::reference_id_value:
+        case AnyKind::other:
+            break;
+    }
+    return false;
+}
+
+namespace {
+
+bool _can_share(AnyDictionary const& source);
+
+bool
+_can_share(std::any const& source)
+{
+    switch (safely_typed_any_kind(source))
+    {
+        case AnyKind::dictionary_value:
+            return _can_share(std::any_cast<AnyDictionary const&>(source));
+        case AnyKind::vector_value:
+            for (auto const& e: std::any_cast<AnyVector const&>(source))
+            {
+                if (!_can_share(e))
+                {
+                    return false;
+                }
+            }
+            return true;
+        case AnyKind::null_value:
+        case AnyKind::bool_value:
+        case AnyKind::int64_value:
+        case AnyKind::double_value:
+        case AnyKind::string_value:
+        case AnyKind::rational_time_value:
+        case AnyKind::time_range_value:
+        case AnyKind::time_transform_value:
+        case AnyKind::point_value:
+        case AnyKind::box_value:
+            return true;
+
+        // objects must be cloned, and these are changed by copying
+        case AnyKind::object_value:
+        case AnyKind::c_string_value:
+        case AnyKind::int_value:
+        case AnyKind::uint64_value:
+        case AnyKind::reference_id_value:
+        case AnyKind::other:
+            break;
+    }
+    return false;
+}
+
+bool
+_can_share(AnyDictionary const& source)
+{
+    if (source.find("OTIO_SCHEMA") != source.end())
+    {
+        return false;
+    }
+    for (auto const& e: source)
+    {
+        if (!_can_share(e.second))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+bool
+SerializableObject::Cloner::can_share(AnyDictionary const& source) const
+{
+    return _can_share(source);
+}
+
+void
+SerializableObject::Cloner::error(ErrorStatus const& error_status)
+{
+    if (!has_errored())
+    {
+        _error_status = error_status;
+    }
+}
+
+bool
+SerializableObject::Comparer::_equal(
+    SerializableObject const* lhs,
+    SerializableObject const* rhs)
+{
+    if (!lhs || !rhs)
+    {
+        return lhs == rhs;
+    }
+
+    // a cycle cannot be written, so it is never equivalent to anything
+    for (auto ancestor: _objects_being_compared)
+    {
+        if (ancestor == lhs)
+        {
+            return false;
+        }
+    }
+
+    if (lhs->_type_record() != rhs->_type_record())
+    {
+        // an unknown schema is written with its original label, which may
+        // be that of a known one
+        if (!lhs->is_unknown_schema() && !rhs->is_unknown_schema())
+        {
+            return false;
+        }
+    }
+    else if (typeid(*lhs) == typeid(*rhs) && lhs->_handled_directly())
+    {
+        _objects_being_compared.push_back(lhs);
+        const bool equal = lhs->_equals(*rhs, *this);
+        _objects_being_compared.pop_back();
+        return equal;
+    }
+
+    return _equivalent_through_encoder(
+        std::any(Retainer<>(lhs)),
+        std::any(Retainer<>(rhs)));
+}
+
+bool
+SerializableObject::Comparer::equal(
+    AnyDictionary const& lhs,
+    AnyDictionary const& rhs)
+{
+    if (lhs.size() != rhs.size())
+    {
+        return false;
+    }
+
+    auto r = rhs.begin();
+    for (auto const& l: lhs)
+    {
+        if (l.first != r->first || !equal(l.second, r->second))
+        {
+            return false;
+        }
+        ++r;
+    }
+    return true;
+}
+
+bool
+SerializableObject::Comparer::equal(AnyVector const& lhs, AnyVector const& rhs)
+{
+    if (lhs.size() != rhs.size())
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < lhs.size(); i++)
+    {
+        if (!equal(lhs[i], rhs[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool
+SerializableObject::Comparer::equal(std::any const& lhs, std::any const& rhs)
+{
+    const AnyKind kind = safely_typed_any_kind(lhs);
+    if (kind == safely_typed_any_kind(rhs))
+    {
+        switch (kind)
+        {
+            case AnyKind::dictionary_value:
+                return equal(
+                    std::any_cast<AnyDictionary const&>(lhs),
+                    std::any_cast<AnyDictionary const&>(rhs));
+            case AnyKind::vector_value:
+                return equal(
+                    std::any_cast<AnyVector const&>(lhs),
+                    std::any_cast<AnyVector const&>(rhs));
+            case AnyKind::object_value:
+                return _equal(
+                    std::any_cast<Retainer<> const&>(lhs).value,
+                    std::any_cast<Retainer<> const&>(rhs).value);
+            case AnyKind::null_value:
+                return true;
+            case AnyKind::bool_value:
+                return _simple_any_comparison<bool>(lhs, rhs);
+            case AnyKind::int64_value:
+                return _simple_any_comparison<int64_t>(lhs, rhs);
+            case AnyKind::double_value:
+                return _simple_any_comparison<double>(lhs, rhs);
+            case AnyKind::string_value:
+                return _simple_any_comparison<std::string>(lhs, rhs);
+            case AnyKind::rational_time_value:
+                return _simple_any_comparison<RationalTime>(lhs, rhs);
+            case AnyKind::time_range_value:
+                return _simple_any_comparison<TimeRange>(lhs, rhs);
+            default:
+                break;
+        }
+    }
+
+    // values of different types may still be written the same way, such as
+    // a char const* and a std::string, so leave the rest to the encoder
+    return _equivalent_through_encoder(lhs, rhs);
+}
+
 // to json_string
 std::string
 serialize_json_to_string_pretty(
@@ -1326,6 +2044,23 @@ serialize_json_to_string(
         error_status);
 }
 
+// write to a rapidjson writer of any kind
+template <typename RapidJSONWriterType>
+static bool
+_write_json_root(
+    std::any const&           value,
+    RapidJSONWriterType&      json_writer,
+    const schema_version_map* schema_version_targets,
+    ErrorStatus*              error_status)
+{
+    JSONEncoder<RapidJSONWriterType> json_encoder(json_writer);
+    return SerializableObject::Writer::write_root(
+        value,
+        json_encoder,
+        schema_version_targets,
+        error_status);
+}
+
 bool
 serialize_json_to_file(
     std::any const&           value,
@@ -1334,18 +2069,21 @@ serialize_json_to_file(
     ErrorStatus*              error_status,
     int                       indent)
 {
-
+    FILE* fp = nullptr;
 #if defined(_WINDOWS)
     const int wlen =
         MultiByteToWideChar(CP_UTF8, 0, file_name.c_str(), -1, NULL, 0);
     std::vector<wchar_t> wchars(wlen);
     MultiByteToWideChar(CP_UTF8, 0, file_name.c_str(), -1, wchars.data(), wlen);
-    std::ofstream os(wchars.data());
+    if (_wfopen_s(&fp, wchars.data(), L"w") != 0)
+    {
+        fp = nullptr;
+    }
 #else  // _WINDOWS
-    std::ofstream os(file_name);
+    fp = fopen(file_name.c_str(), "w");
 #endif // _WINDOWS
 
-    if (!os.is_open())
+    if (!fp)
     {
         if (error_status)
         {
@@ -1355,28 +2093,58 @@ serialize_json_to_file(
         return false;
     }
 
-    OTIO_rapidjson::OStreamWrapper osw(os);
-    bool                           status;
+    // the writers put one character at a time, so give them a large buffer
+    // and let it reach the file in big writes
+    constexpr size_t                buffer_size = 1024 * 1024;
+    std::unique_ptr<char[]>         buffer(new char[buffer_size]);
+    OTIO_rapidjson::FileWriteStream fws(fp, buffer.get(), buffer_size);
+    bool                            status;
 
-    OTIO_rapidjson::PrettyWriter<
-        decltype(osw),
-        OTIO_rapidjson::UTF8<>,
-        OTIO_rapidjson::UTF8<>,
-        OTIO_rapidjson::CrtAllocator,
-        OTIO_rapidjson::kWriteNanAndInfFlag>
-                                       json_writer(osw);
-    JSONEncoder<decltype(json_writer)> json_encoder(json_writer);
-
-    if (indent >= 0)
+    if (indent > 0)
     {
+        OTIO_rapidjson::PrettyWriter<
+            decltype(fws),
+            OTIO_rapidjson::UTF8<>,
+            OTIO_rapidjson::UTF8<>,
+            OTIO_rapidjson::CrtAllocator,
+            OTIO_rapidjson::kWriteNanAndInfFlag>
+            json_writer(fws);
         json_writer.SetIndent(' ', indent);
+
+        status = _write_json_root(
+            value,
+            json_writer,
+            schema_version_targets,
+            error_status);
+    }
+    else
+    {
+        OTIO_rapidjson::Writer<
+            decltype(fws),
+            OTIO_rapidjson::UTF8<>,
+            OTIO_rapidjson::UTF8<>,
+            OTIO_rapidjson::CrtAllocator,
+            OTIO_rapidjson::kWriteNanAndInfFlag>
+            json_writer(fws);
+
+        status = _write_json_root(
+            value,
+            json_writer,
+            schema_version_targets,
+            error_status);
     }
 
-    status = SerializableObject::Writer::write_root(
-        value,
-        json_encoder,
-        schema_version_targets,
-        error_status);
+    fws.Flush();
+    const bool write_failed = ferror(fp) != 0;
+    if ((fclose(fp) != 0 || write_failed) && status)
+    {
+        if (error_status)
+        {
+            *error_status =
+                ErrorStatus(ErrorStatus::FILE_WRITE_FAILED, file_name);
+        }
+        status = false;
+    }
 
     return status;
 }
@@ -38,6 +38,12 @@ Stack::write_to(Writer& writer) const
     Parent::write_to(writer);
 }
 
+std::type_info const&
+Stack::_direct_class() const
+{
+    return typeid(Stack);
+}
+
 TimeRange
 Stack::range_of_child_at_index(int index, ErrorStatus* error_status) const
 {
@@ -61,42 +67,55 @@ Stack::range_of_child_at_index(int index, ErrorStatus* error_status) const
     return TimeRange(RationalTime(0, duration.rate()), duration);
 }
 
-std::map<Composable*, TimeRange>
-Stack::range_of_all_children(ErrorStatus* error_status) const
+void
+Stack::child_ranges(
+    std::vector<TimeRange>* ranges,
+    ErrorStatus*            error_status) const
 {
-    std::map<Composable*, TimeRange> result;
-    auto                             kids = children();
+    ranges->clear();
+    ranges->reserve(children().size());
 
-    for (size_t i = 0; i < kids.size(); i++)
+    for (size_t i = 0; i < children().size(); i++)
     {
-        result[kids[i]] = range_of_child_at_index(int(i), error_status);
+        ranges->push_back(range_of_child_at_index(int(i), error_status));
         if (is_error(error_status))
         {
             break;
         }
     }
+}
 
-    return result;
+std::map<Composable*, TimeRange>
+Stack::range_of_all_children(ErrorStatus* error_status) const
+{
+    return _child_range_map(error_status);
 }
 
-std::vector<SerializableObject::Retainer<Composable>>
-Stack::children_in_range(
+void
+Stack::_child_index_span(
+    TimeRange const& /* search_range */,
+    size_t*      first,
+    size_t*      last,
+    ErrorStatus* /* error_status */) const
+{
+    // the children of a stack all start together, so any of them may
+    // intersect the search range
+    *first = 0;
+    *last  = children().size();
+}
+
+bool
+Stack::_child_in_range(
+    size_t           index,
     TimeRange const& search_range,
-    ErrorStatus* error_status) const
+    ErrorStatus*     error_status) const
 {
-    std::vector<SerializableObject::Retainer<Composable>> children;
-    for (const auto& child : this->children())
+    if (auto item = dynamic_cast<Item*>(children()[index].value))
     {
-        if (const auto& item = dynamic_retainer_cast<Item>(child))
-        {
-            const auto range = item->trimmed_range_in_parent(error_status);
-            if (range.has_value() && range.value().intersects(search_range))
-            {
-                children.push_back(child);
-            }
-        }
+        const auto range = item->trimmed_range_in_parent(error_status);
+        return range.has_value() && range.value().intersects(search_range);
     }
-    return children;
+    return false;
 }
 
 TimeRange
@@ -116,7 +135,7 @@ Stack::trimmed_range_of_child_at_index(int index, ErrorStatus* error_status)
 }
 
 TimeRange
-Stack::available_range(ErrorStatus* error_status) const
+Stack::_compute_available_range(ErrorStatus* error_status) const
 {
     if (children().empty())
     {
@@ -34,16 +34,14 @@ public:
     TimeRange trimmed_range_of_child_at_index(
         int          index,
         ErrorStatus* error_status = nullptr) const override;
-    TimeRange
-    available_range(ErrorStatus* error_status = nullptr) const override;
+
+    void child_ranges(
+        std::vector<TimeRange>* ranges,
+        ErrorStatus*            error_status = nullptr) const override;
 
     std::map<Composable*, TimeRange>
     range_of_all_children(ErrorStatus* error_status = nullptr) const override;
 
-    std::vector<Retainer<Composable>> children_in_range(
-        TimeRange const& search_range,
-        ErrorStatus*     error_status = nullptr) const override;
-
     std::optional<IMATH_NAMESPACE::Box2d>
     available_image_bounds(ErrorStatus* error_status) const override;
 
@@ -62,8 +60,23 @@ protected:
 
     std::string composition_kind() const override;
 
+    TimeRange _compute_available_range(
+        ErrorStatus* error_status = nullptr) const override;
+
+    void _child_index_span(
+        TimeRange const& search_range,
+        size_t*          first,
+        size_t*          last,
+        ErrorStatus*     error_status = nullptr) const override;
+    bool _child_in_range(
+        size_t           index,
+        TimeRange const& search_range,
+        ErrorStatus*     error_status = nullptr) const override;
+
     bool read_from(Reader&) override;
     void write_to(Writer&) const override;
+
+    std::type_info const& _direct_class() const override;
 };
 
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
@@ -9,7 +9,7 @@
 
 namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
 
-typedef std::map<Track*, std::map<Composable*, TimeRange>> RangeTrackMap;
+typedef std::map<Track*, std::vector<TimeRange>>          RangeTrackMap;
 typedef std::vector<SerializableObject::Retainer<Track>>   TrackRetainerVector;
 
 static void
@@ -44,25 +44,25 @@ _flatten_next_item(
         track_retainer = SerializableObject::Retainer<Track>(track);
     }
 
-    std::map<Composable*, TimeRange>* track_map;
-    auto                              it = range_track_map.find(track);
+    std::vector<TimeRange>* track_ranges;
+    auto                    it = range_track_map.find(track);
     if (it != range_track_map.end())
     {
-        track_map = &it->second;
+        track_ranges = &it->second;
     }
     else
     {
-        auto result = range_track_map.emplace(
-            track,
-            track->range_of_all_children(error_status));
+        auto result = range_track_map.emplace(track, std::vector<TimeRange>());
+        track_ranges = &result.first->second;
+        track->child_ranges(track_ranges, error_status);
         if (is_error(error_status))
         {
             return;
         }
-        track_map = &result.first->second;
     }
-    for (auto child: track->children())
+    for (size_t i = 0; i < track->children().size(); i++)
     {
+        auto child = track->children()[i];
         auto item = dynamic_retainer_cast<Item>(child);
         if (!item)
         {
@@ -92,13 +92,13 @@ _flatten_next_item(
         }
         else
         {
-            TimeRange trim = (*track_map)[item];
+            TimeRange trim = (*track_ranges)[i];
             if (trim_range)
             {
                 trim = TimeRange(
                     trim.start_time() + trim_range->start_time(),
                     trim.duration());
-                (*track_map)[item] = trim;
+                (*track_ranges)[i] = trim;
             }
 
             _flatten_next_item(
@@ -15,4 +15,10 @@ TimeEffect::TimeEffect(
 TimeEffect::~TimeEffect()
 {}
 
+std::type_info const&
+TimeEffect::_direct_class() const
+{
+    return typeid(TimeEffect);
+}
+
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
@@ -26,6 +26,8 @@ public:
 
 protected:
     virtual ~TimeEffect();
+
+    std::type_info const& _direct_class() const override;
 };
 
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
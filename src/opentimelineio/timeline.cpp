@@ -22,6 +22,7 @@ void
 Timeline::set_tracks(Stack* stack)
 {
     _tracks = stack ? stack : new Stack("tracks");
+    content_changed();
 }
 
 bool
@@ -40,6 +41,30 @@ Timeline::write_to(Writer& writer) const
     writer.write("tracks", _tracks);
 }
 
+std::type_info const&
+Timeline::_direct_class() const
+{
+    return typeid(Timeline);
+}
+
+bool
+Timeline::_copy_to(SerializableObject* clone, Cloner& cloner) const
+{
+    auto c                = static_cast<Timeline*>(clone);
+    c->_global_start_time = _global_start_time;
+    return cloner.copy(_tracks, &c->_tracks)
+           && Parent::_copy_to(clone, cloner);
+}
+
+bool
+Timeline::_equals(SerializableObject const& other, Comparer& comparer) const
+{
+    auto const& o = static_cast<Timeline const&>(other);
+    return _global_start_time == o._global_start_time
+           && Parent::_equals(other, comparer)
+           && comparer.equal(_tracks, o._tracks);
+}
+
 std::vector<Track*>
 Timeline::video_tracks() const
 {
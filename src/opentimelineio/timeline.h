@@ -46,6 +46,7 @@ public:
     set_global_start_time(std::optional<RationalTime> const& global_start_time)
     {
         _global_start_time = global_start_time;
+        content_changed();
     }
 
     RationalTime duration(ErrorStatus* error_status = nullptr) const
@@ -96,6 +97,10 @@ protected:
     bool read_from(Reader&) override;
     void write_to(Writer&) const override;
 
+    std::type_info const& _direct_class() const override;
+    bool _copy_to(SerializableObject* clone, Cloner&) const override;
+    bool _equals(SerializableObject const& other, Comparer&) const override;
+
 private:
     std::optional<RationalTime> _global_start_time;
     Retainer<Stack>             _tracks;
@@ -41,6 +41,27 @@ Track::write_to(Writer& writer) const
     writer.write("kind", _kind);
 }
 
+std::type_info const&
+Track::_direct_class() const
+{
+    return typeid(Track);
+}
+
+bool
+Track::_copy_to(SerializableObject* clone, Cloner& cloner) const
+{
+    static_cast<Track*>(clone)->_kind = _kind;
+    return Parent::_copy_to(clone, cloner);
+}
+
+bool
+Track::_equals(SerializableObject const& other, Comparer& comparer) const
+{
+    auto const& o = static_cast<Track const&>(other);
+    return _kind == o._kind
+           && Parent::_equals(other, comparer);
+}
+
 TimeRange
 Track::range_of_child_at_index(int index, ErrorStatus* error_status) const
 {
@@ -61,19 +82,11 @@ Track::range_of_child_at_index(int index, ErrorStatus* error_status) const
         return TimeRange();
     }
 
-    RationalTime start_time(0, child_duration.rate());
-
-    for (int i = 0; i < index; i++)
+    RationalTime start_time = RationalTime(0, child_duration.rate())
+                              + _start_time_of_child(index, error_status);
+    if (is_error(error_status))
     {
-        Composable* child2 = children()[i];
-        if (!child2->overlapping())
-        {
-            start_time += children()[i]->duration(error_status);
-        }
-        if (is_error(error_status))
-        {
-            return TimeRange();
-        }
+        return TimeRange();
     }
 
     if (auto transition = dynamic_cast<Transition*>(child))
@@ -84,6 +97,45 @@ Track::range_of_child_at_index(int index, ErrorStatus* error_status) const
     return TimeRange(start_time, child_duration);
 }
 
+RationalTime
+Track::_start_time_of_child(int index, ErrorStatus* error_status) const
+{
+    std::lock_guard<std::mutex> lock(_timing_cache_mutex);
+    if (_start_times.empty())
+    {
+        _start_times.reserve(children().size() + 1);
+        _start_times.push_back(RationalTime());
+    }
+
+    // extend the table up to index; a child whose duration can't be
+    // computed stops the table there, so later queries report the error too
+    while (int(_start_times.size()) <= index)
+    {
+        Composable*  child      = children()[_start_times.size() - 1];
+        RationalTime start_time = _start_times.back();
+        if (!child->overlapping())
+        {
+            start_time += child->duration(error_status);
+            if (is_error(error_status))
+            {
+                return RationalTime();
+            }
+        }
+        _start_times.push_back(start_time);
+    }
+
+    return _start_times[index];
+}
+
+void
+Track::_invalidate_timing_cache() noexcept
+{
+    Parent::_invalidate_timing_cache();
+
+    std::lock_guard<std::mutex> lock(_timing_cache_mutex);
+    _start_times.clear();
+}
+
 TimeRange
 Track::trimmed_range_of_child_at_index(int index, ErrorStatus* error_status)
     const
@@ -108,7 +160,7 @@ Track::trimmed_range_of_child_at_index(int index, ErrorStatus* error_status)
 }
 
 TimeRange
-Track::available_range(ErrorStatus* error_status) const
+Track::_compute_available_range(ErrorStatus* error_status) const
 {
     RationalTime duration;
     for (const auto& child: children())
@@ -211,56 +263,68 @@ Track::neighbors_of(
     return result;
 }
 
-std::map<Composable*, TimeRange>
-Track::range_of_all_children(ErrorStatus* error_status) const
+void
+Track::child_ranges(
+    std::vector<TimeRange>* ranges,
+    ErrorStatus*            error_status) const
 {
-    std::map<Composable*, TimeRange> result;
+    ranges->clear();
     if (children().empty())
     {
-        return result;
+        return;
     }
 
-    auto   first_child = children().front();
-    double rate        = 1;
+    auto const& first_child = children().front();
+    double      rate        = 1;
 
-    if (auto transition = dynamic_retainer_cast<Transition>(first_child))
+    if (auto transition = dynamic_cast<Transition*>(first_child.value))
     {
         rate = transition->in_offset().rate();
     }
-    else if (auto item = dynamic_retainer_cast<Item>(first_child))
+    else if (auto item = dynamic_cast<Item*>(first_child.value))
     {
         rate = item->trimmed_range(error_status).duration().rate();
         if (is_error(error_status))
         {
-            return result;
+            return;
         }
     }
 
+    ranges->reserve(children().size());
+
     RationalTime last_end_time(0, rate);
     for (const auto& child: children())
     {
-        if (auto transition = dynamic_retainer_cast<Transition>(child))
+        if (auto transition = dynamic_cast<Transition*>(child.value))
         {
-            result[child] = TimeRange(
+            ranges->emplace_back(
                 last_end_time - transition->in_offset(),
                 transition->out_offset() + transition->in_offset());
         }
-        else if (auto item = dynamic_retainer_cast<Item>(child))
+        else if (auto item = dynamic_cast<Item*>(child.value))
         {
             auto last_range = TimeRange(
                 last_end_time,
                 item->trimmed_range(error_status).duration());
-            result[child] = last_range;
+            ranges->push_back(last_range);
             last_end_time = last_range.end_time_exclusive();
         }
+        else
+        {
+            ranges->emplace_back();
+        }
 
         if (is_error(error_status))
         {
-            return result;
+            return;
         }
     }
+}
 
-    return result;
+std::map<Composable*, TimeRange>
+Track::range_of_all_children(ErrorStatus* error_status) const
+{
+    return _child_range_map(error_status);
 }
 
 std::vector<SerializableObject::Retainer<Clip>>
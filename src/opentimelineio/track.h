@@ -6,6 +6,8 @@
 #include "opentimelineio/composition.h"
 #include "opentimelineio/version.h"
 
+#include <mutex>
+
 namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
 
 class Clip;
@@ -41,7 +43,11 @@ public:
 
     std::string kind() const noexcept { return _kind; }
 
-    void set_kind(std::string const& kind) { _kind = kind; }
+    void set_kind(std::string const& kind)
+    {
+        _kind = kind;
+        content_changed();
+    }
 
     TimeRange range_of_child_at_index(
         int          index,
@@ -49,8 +55,6 @@ public:
     TimeRange trimmed_range_of_child_at_index(
         int          index,
         ErrorStatus* error_status = nullptr) const override;
-    TimeRange
-    available_range(ErrorStatus* error_status = nullptr) const override;
 
     std::pair<std::optional<RationalTime>, std::optional<RationalTime>>
     handles_of_child(
@@ -62,6 +66,10 @@ public:
         ErrorStatus*      error_status = nullptr,
         NeighborGapPolicy insert_gap   = NeighborGapPolicy::never) const;
 
+    void child_ranges(
+        std::vector<TimeRange>* ranges,
+        ErrorStatus*            error_status = nullptr) const override;
+
     std::map<Composable*, TimeRange>
     range_of_all_children(ErrorStatus* error_status = nullptr) const override;
 
@@ -83,11 +91,33 @@ protected:
 
     std::string composition_kind() const override;
 
+    TimeRange _compute_available_range(
+        ErrorStatus* error_status = nullptr) const override;
+
     bool read_from(Reader&) override;
     void write_to(Writer&) const override;
 
+    std::type_info const& _direct_class() const override;
+    bool _copy_to(SerializableObject* clone, Cloner&) const override;
+    bool _equals(SerializableObject const& other, Comparer&) const override;
+
+    void _invalidate_timing_cache() noexcept override;
+
 private:
+    // Return the sum of the durations of the non-overlapping children that
+    // precede the child at index.
+    RationalTime
+    _start_time_of_child(int index, ErrorStatus* error_status) const;
+
     std::string _kind;
+
+    // Lazily built prefix sums of the child durations: _start_times[i] is the
+    // value _start_time_of_child(i) returns.  The table is only extended as
+    // far as it has been queried, and is cleared when the children change.
+    // Guarded by _timing_cache_mutex.
+    mutable std::vector<RationalTime> _start_times;
+
+    friend class JSONDecoder;
 };
 
 }} // namespace opentimelineio::OPENTIMELINEIO_VERSION
@@ -18,7 +18,8 @@ track_trimmed_to_range(
         return nullptr;
     }
 
-    auto track_map = new_track->range_of_all_children(error_status);
+    std::vector<TimeRange> track_ranges;
+    new_track->child_ranges(&track_ranges, error_status);
     if (is_error(error_status))
     {
         return nullptr;
@@ -30,20 +31,19 @@ track_trimmed_to_range(
 
     for (size_t i = children_copy.size(); i--;)
     {
-        Composable* child          = children_copy[i];
-        auto        child_range_it = track_map.find(child);
-        if (child_range_it == track_map.end())
+        Composable* child = children_copy[i];
+        if (i >= track_ranges.size())
         {
             if (error_status)
             {
                 *error_status = ErrorStatus(
                     ErrorStatus::CANNOT_COMPUTE_AVAILABLE_RANGE,
-                    "failed to find child in track_map map");
+                    "failed to find child in track_ranges");
             }
             return nullptr;
         }
 
-        auto child_range = child_range_it->second;
+        auto child_range = track_ranges[i];
         if (!trim_range.intersects(child_range))
         {
             new_track->remove_child(static_cast<int>(i), error_status);
@@ -45,6 +45,32 @@ Transition::write_to(Writer& writer) const
     writer.write("transition_type", _transition_type);
 }
 
+std::type_info const&
+Transition::_direct_class() const
+{
+    return typeid(Transition);
+}
+
+bool
+Transition::_copy_to(SerializableObject* clone, Cloner& cloner) const
+{
+    auto c              = static_cast<Transition*>(clone);
+    c->_transition_type = _transition_type;
+    c->_in_offset       = _in_offset;
+    c->_out_offset      = _out_offset;
+    return Parent::_copy_to(clone, cloner);
+}
+
+bool
+Transition::_equals(SerializableObject const& other, Comparer& comparer) const
+{
+    auto const& o = static_cast<Transition const&>(other);
+    return _transition_type == o._transition_type
+           && _in_offset == o._in_offset
+           && _out_offset == o._out_offset
+           && Parent::_equals(other, comparer);
+}
+
 RationalTime
 Transition::duration(ErrorStatus* /* error_status */) const
 {
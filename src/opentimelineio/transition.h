@@ -39,6 +39,7 @@ public:
     void set_transition_type(std::string const& transition_type)
     {
         _transition_type = transition_type;
+        content_changed();
     }
 
     RationalTime in_offset() const noexcept { return _in_offset; }
@@ -46,6 +47,7 @@ public:
     void set_in_offset(RationalTime const& in_offset) noexcept
     {
         _in_offset = in_offset;
+        _timing_changed();
     }
 
     RationalTime out_offset() const noexcept { return _out_offset; }
@@ -53,6 +55,7 @@ public:
     void set_out_offset(RationalTime const& out_offset) noexcept
     {
         _out_offset = out_offset;
+        _timing_changed();
     }
 
     RationalTime duration(ErrorStatus* error_status = nullptr) const override;
@@ -69,6 +72,10 @@ protected:
     bool read_from(Reader&) override;
     void write_to(Writer&) const override;
 
+    std::type_info const& _direct_class() const override;
+    bool _copy_to(SerializableObject* clone, Cloner&) const override;
+    bool _equals(SerializableObject const& other, Comparer&) const override;
+
 private:
     std::string  _transition_type;
     RationalTime _in_offset, _out_offset;
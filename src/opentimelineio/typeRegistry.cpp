@@ -92,7 +92,8 @@ TypeRegistry::TypeRegistry()
      * Upgrade functions:
      */
     register_upgrade_function(Marker::Schema::name, 2, [](AnyDictionary* d) {
-        (*d)["marked_range"] = (*d)["range"];
+        auto range           = (*d)["range"];
+        (*d)["marked_range"] = range;
         d->erase("range");
     });
 
@@ -171,6 +172,7 @@ TypeRegistry::register_type(
     {
         _TypeRecord* r =
             new _TypeRecord{ schema_name, schema_version, class_name, create };
+        r->type                    = type;
         _type_records[schema_name] = r;
         if (type)
         {
@@ -197,6 +199,7 @@ TypeRegistry::register_type_from_existing_type(
                                                           r->schema_version,
                                                           r->class_name,
                                                           r->create };
+            _type_records[schema_name]->type = r->type;
             return true;
         }
 
@@ -11,6 +11,7 @@
 #include <map>
 #include <mutex>
 #include <string>
+#include <typeinfo>
 #include <unordered_map>
 
 namespace opentimelineio { namespace OPENTIMELINEIO_VERSION {
@@ -162,6 +163,12 @@ private:
         std::string                          class_name;
         std::function<SerializableObject*()> create;
 
+        // "schema_name.schema_version", as written under OTIO_SCHEMA
+        std::string schema_label;
+
+        // The C++ class registered for the schema, if there is one.
+        std::type_info const* type = nullptr;
+
         std::map<int, std::function<void(AnyDictionary*)>> upgrade_functions;
         std::map<int, std::function<void(AnyDictionary*)>> downgrade_functions;
 
@@ -175,6 +182,8 @@ private:
             this->schema_version = _schema_version;
             this->class_name     = _class_name;
             this->create         = _create;
+            this->schema_label =
+                _schema_name + "." + std::to_string(_schema_version);
         }
 
         SerializableObject* create_object() const;
@@ -161,6 +161,12 @@ static void define_bases1(py::module m) {
                 auto ptr = s->dynamic_fields().get_or_create_mutation_stamp();
                 return (AnyDictionaryProxy*)(ptr); }, py::return_value_policy::take_ownership)
         .def("is_equivalent_to", &SerializableObject::is_equivalent_to, "other"_a.none(false))
+        .def("content_hash", [](SerializableObject* so) {
+                return so->content_hash(ErrorStatusHandler()).to_string(); },
+            "Return a digest of everything this object would serialize, as a hex string.")
+        .def("content_changed", &SerializableObject::content_changed,
+            "Mark the cached content hash of this object and of the objects holding it as out of date, "
+            "for example after editing a metadata dictionary or list kept from an earlier access.")
         .def("clone", [](SerializableObject* so) {
                 return so->clone(ErrorStatusHandler()); })
         .def("to_json_string", [](SerializableObject* so, int indent) {
@@ -170,13 +176,19 @@ static void define_bases1(py::module m) {
                 return so->to_json_file(file_name, ErrorStatusHandler(), {}, indent); },
             "file_name"_a,
             "indent"_a = 4)
-        .def_static("from_json_file", [](std::string file_name) {
-                return SerializableObject::from_json_file(file_name, ErrorStatusHandler()); },
-            "file_name"_a)
-        .def_static("from_json_string", [](std::string input) {
-                return SerializableObject::from_json_string(input, ErrorStatusHandler());
+        .def_static("from_json_file", [](std::string file_name, bool intern_strings) {
+                ReadOptions options;
+                options.intern_strings = intern_strings;
+                return SerializableObject::from_json_file(file_name, ErrorStatusHandler(), options); },
+            "file_name"_a,
+            "intern_strings"_a = false)
+        .def_static("from_json_string", [](std::string input, bool intern_strings) {
+                ReadOptions options;
+                options.intern_strings = intern_strings;
+                return SerializableObject::from_json_string(input, ErrorStatusHandler(), options);
             },
-            "input"_a)
+            "input"_a,
+            "intern_strings"_a = false)
         .def("schema_name", &SerializableObject::schema_name)
         .def("schema_version", &SerializableObject::schema_version)
         .def_property_readonly("is_unknown_schema", &SerializableObject::is_unknown_schema);
@@ -554,7 +566,9 @@ Should be subclassed (for example by :class:`.Track` and :class:`.Stack`), not u
              py::arg_v("metadata"_a = py::none()))
         .def("parent", &Composable::parent)
         .def("visible", &Composable::visible)
-        .def("overlapping", &Composable::overlapping);
+        .def("overlapping", &Composable::overlapping)
+        .def("modification_stamp", &Composable::modification_stamp, "A counter that increases whenever this object, or anything below it, changes in a way that can affect timing.")
+        .def("mark_modified", &Composable::mark_modified, "Bump the modification stamp of this object and its ancestors, for example after editing markers in place.");
 
     auto track_class = py::class_<Track, Composition, managing_ptr<Track>>(m, "Track", py::dynamic_attr());
 
@@ -49,49 +49,14 @@ py::object plain_uint(uint64_t i) {
     return py::reinterpret_steal<py::object>(p);
 }
 
+// The types only the bindings put in a std::any; the rest are handled by
+// any_to_py() directly.
 void _build_any_to_py_dispatch_table() {
     auto& t = _py_cast_dispatch_table;
 
-    t[&typeid(void)] = [](std::any const& /* a */, bool) { return py::none(); };
-    t[&typeid(bool)] = [](std::any const& a, bool) { return py::cast(safely_cast_bool_any(a)); };
-    t[&typeid(int)] = [](std::any const& a, bool) {  return plain_int(safely_cast_int_any(a)); };
-    t[&typeid(int64_t)] = [](std::any const& a, bool) {  return plain_int(safely_cast_int64_any(a)); };
-    t[&typeid(uint64_t)] = [](std::any const& a, bool) {  return plain_uint(safely_cast_uint64_any(a)); };
-    t[&typeid(double)] = [](std::any const& a, bool) { return py::cast(safely_cast_double_any(a)); };
-    t[&typeid(std::string)] = [](std::any const& a, bool) { return py::cast(safely_cast_string_any(a)); };
-    t[&typeid(RationalTime)] = [](std::any const& a, bool) { return py::cast(safely_cast_rational_time_any(a)); };
-    t[&typeid(TimeRange)] = [](std::any const& a, bool) { return py::cast(safely_cast_time_range_any(a)); };
-    t[&typeid(TimeTransform)] = [](std::any const& a, bool) { return py::cast(safely_cast_time_transform_any(a)); };
-    t[&typeid(IMATH_NAMESPACE::V2d)] = [](std::any const& a, bool) { return py::cast(safely_cast_point_any(a)); };
-    t[&typeid(IMATH_NAMESPACE::Box2d)] = [](std::any const& a, bool) { return py::cast(safely_cast_box_any(a)); };
-    t[&typeid(SerializableObject::Retainer<>)] = [](std::any const& a, bool) {
-        SerializableObject* so = safely_cast_retainer_any(a);
-        return py::cast(managing_ptr<SerializableObject>(so)); };
     t[&typeid(AnyDictionaryProxy*)] = [](std::any const& a, bool) { return py::cast(std::any_cast<AnyDictionaryProxy*>(a)); };
     t[&typeid(AnyVectorProxy*)] = [](std::any const& a, bool) { return py::cast(std::any_cast<AnyVectorProxy*>(a)); };
 
-    t[&typeid(AnyDictionary)] = [](std::any const& a, bool top_level) {
-        AnyDictionary& d = temp_safely_cast_any_dictionary_any(a);
-        if (top_level) {
-            auto proxy = new AnyDictionaryProxy;
-            proxy->fetch_any_dictionary().swap(d);
-            return py::cast(proxy);
-        }
-        else {
-            return py::cast((AnyDictionaryProxy*)d.get_or_create_mutation_stamp());
-        }
-    };
-    
-    t[&typeid(AnyVector)] = [](std::any const& a, bool top_level) {
-        AnyVector& v = temp_safely_cast_any_vector_any(a);
-        if (top_level) {
-            auto proxy = new AnyVectorProxy;
-            proxy->fetch_any_vector().swap(v);
-            return py::cast(proxy);
-        }
-        return py::cast((AnyVectorProxy*)v.get_or_create_mutation_stamp());
-    };
-
     for (auto e: t) {
         _py_cast_dispatch_table_by_name[e.first->name()] = e.second;
     }
@@ -124,6 +89,59 @@ AnyDictionary py_to_any_dictionary(py::object const& o) {
 }
 
 py::object any_to_py(std::any const& a, bool top_level) {
+    switch (safely_typed_any_kind(a)) {
+        case AnyKind::null_value:
+            return py::none();
+        case AnyKind::bool_value:
+            return py::cast(safely_cast_bool_any(a));
+        case AnyKind::int_value:
+            return plain_int(safely_cast_int_any(a));
+        case AnyKind::int64_value:
+            return plain_int(safely_cast_int64_any(a));
+        case AnyKind::uint64_value:
+            return plain_uint(safely_cast_uint64_any(a));
+        case AnyKind::double_value:
+            return py::cast(safely_cast_double_any(a));
+        case AnyKind::string_value:
+            return py::cast(safely_cast_string_any(a));
+        case AnyKind::rational_time_value:
+            return py::cast(safely_cast_rational_time_any(a));
+        case AnyKind::time_range_value:
+            return py::cast(safely_cast_time_range_any(a));
+        case AnyKind::time_transform_value:
+            return py::cast(safely_cast_time_transform_any(a));
+        case AnyKind::point_value:
+            return py::cast(safely_cast_point_any(a));
+        case AnyKind::box_value:
+            return py::cast(safely_cast_box_any(a));
+        case AnyKind::object_value: {
+            SerializableObject* so = safely_cast_retainer_any(a);
+            return py::cast(managing_ptr<SerializableObject>(so));
+        }
+        case AnyKind::dictionary_value: {
+            AnyDictionary& d = temp_safely_cast_any_dictionary_any(a);
+            if (top_level) {
+                auto proxy = new AnyDictionaryProxy;
+                proxy->fetch_any_dictionary().swap(d);
+                return py::cast(proxy);
+            }
+            return py::cast((AnyDictionaryProxy*)d.get_or_create_mutation_stamp());
+        }
+        case AnyKind::vector_value: {
+            AnyVector& v = temp_safely_cast_any_vector_any(a);
+            if (top_level) {
+                auto proxy = new AnyVectorProxy;
+                proxy->fetch_any_vector().swap(v);
+                return py::cast(proxy);
+            }
+            return py::cast((AnyVectorProxy*)v.get_or_create_mutation_stamp());
+        }
+        case AnyKind::c_string_value:
+        case AnyKind::reference_id_value:
+        case AnyKind::other:
+            break;
+    }
+
     std::type_info const& tInfo = a.type();
     auto e = _py_cast_dispatch_table.find(&tInfo);
 
@@ -3,6 +3,7 @@
 
 #include "utils.h"
 
+#include <opentimelineio/childRange.h>
 #include <opentimelineio/clip.h>
 #include <opentimelineio/serializableCollection.h>
 #include <opentimelineio/timeline.h>
@@ -88,6 +89,68 @@ main(int argc, char** argv)
         assertEqual(result[0].value, cl.value);
     });
 
+    tests.add_test(
+        "test_child_range", [] {
+        using namespace otio;
+        const TimeRange range(RationalTime(0.0, 24.0), RationalTime(24.0, 24.0));
+        otio::SerializableObject::Retainer<otio::Clip> cl0 =
+            new otio::Clip("cl0", nullptr, range);
+        otio::SerializableObject::Retainer<otio::Clip> cl1 =
+            new otio::Clip("cl1", nullptr, range);
+        otio::SerializableObject::Retainer<otio::Clip> cl2 =
+            new otio::Clip("cl2", nullptr, range);
+        otio::SerializableObject::Retainer<otio::Track> tr =
+            new otio::Track();
+        tr->append_child(cl0);
+        tr->append_child(cl1);
+        otio::SerializableObject::Retainer<otio::Timeline> tl =
+            new otio::Timeline();
+        tl->tracks()->append_child(tr);
+        otio::SerializableObject::Retainer<otio::SerializableCollection>
+            sc = new otio::SerializableCollection();
+        sc->insert_child(0, tl);
+        sc->insert_child(1, cl2);
+        opentimelineio::v1_0::ErrorStatus err;
+
+        std::vector<otio::Clip*> clips;
+        for (auto clip: otio::ChildRange<otio::Clip>(sc, &err))
+        {
+            clips.push_back(clip);
+        }
+        auto result = sc->find_children<otio::Clip>(&err);
+        assertEqual(clips.size(), result.size());
+        for (size_t i = 0; i < clips.size(); i++)
+        {
+            assertEqual(clips[i], result[i].value);
+        }
+
+        // the walk can stop at the first match
+        otio::ChildRange<otio::Clip> first(tl, &err);
+        assertEqual(*first.begin(), cl0.value);
+
+        clips.clear();
+        for (auto clip: otio::ChildRange<otio::Clip>(sc, &err, range))
+        {
+            clips.push_back(clip);
+        }
+        assertEqual(clips.size(), 2);
+        assertEqual(clips[0], cl0.value);
+        assertEqual(clips[1], cl2.value);
+
+        clips.clear();
+        for (auto clip: otio::ChildRange<otio::Clip>(
+                 sc,
+                 &err,
+                 std::nullopt,
+                 true))
+        {
+            clips.push_back(clip);
+        }
+        assertEqual(clips.size(), 1);
+        assertEqual(clips[0], cl2.value);
+        assertFalse(is_error(err));
+    });
+
     tests.run(argc, argv);
     return 0;
 }
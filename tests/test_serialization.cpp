@@ -4,14 +4,22 @@
 #include "utils.h"
 
 #include <opentimelineio/clip.h>
+#include <opentimelineio/deserialization.h>
+#include <opentimelineio/externalReference.h>
+#include <opentimelineio/gap.h>
 #include <opentimelineio/timeline.h>
 #include <opentimelineio/track.h>
+#include <opentimelineio/serializableCollection.h>
 #include <opentimelineio/serialization.h>
 #include <opentimelineio/serializableObject.h>
 #include <opentimelineio/serializableObjectWithMetadata.h>
 #include <opentimelineio/safely_typed_any.h>
+#include <opentimelineio/unknownSchema.h>
 
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <sstream>
 #include <string>
 
 namespace otime = opentime::OPENTIME_VERSION;
@@ -112,6 +120,739 @@ main(int argc, char** argv)
 })CONTENT");
     });
 
+    tests.add_test(
+        "retainer move leaves the reference count unchanged", [] {
+        otio::SerializableObject::Retainer<otio::SerializableObjectWithMetadata> so =
+            new otio::SerializableObjectWithMetadata();
+        assertEqual(so.value->current_ref_count(), 1);
+
+        auto moved = std::move(so);
+        assertEqual(moved.value->current_ref_count(), 1);
+        assertTrue(so.value == nullptr);
+
+        otio::SerializableObject::Retainer<otio::SerializableObjectWithMetadata> copy = moved;
+        assertEqual(moved.value->current_ref_count(), 2);
+        copy = std::move(moved);
+        assertEqual(copy.value->current_ref_count(), 1);
+        assertTrue(moved.value == nullptr);
+    });
+
+    tests.add_test(
+        "value schemas decode whatever their key order", [] {
+        otio::ErrorStatus err;
+        std::any          value;
+        bool              ok = otio::deserialize_json_from_string(
+            R"CONTENT({
+                "OTIO_SCHEMA": "TimeRange.1",
+                "duration": {"OTIO_SCHEMA": "RationalTime.1", "value": 5, "rate": 24},
+                "start_time": {"rate": 24.0, "OTIO_SCHEMA": "RationalTime.1", "value": 1}
+            })CONTENT",
+            &value,
+            &err);
+        assertTrue(ok);
+        assertTrue(value.type() == typeid(otio::TimeRange));
+        assertTrue(
+            std::any_cast<otio::TimeRange>(value)
+            == otio::TimeRange(
+                otio::RationalTime(1, 24),
+                otio::RationalTime(5, 24)));
+
+        ok = otio::deserialize_json_from_string(
+            R"CONTENT({"OTIO_SCHEMA": "RationalTime.1", "rate": "24", "value": 1})CONTENT",
+            &value,
+            &err);
+        assertFalse(ok);
+        assertEqual(err.outcome, otio::ErrorStatus::TYPE_MISMATCH);
+    });
+
+    tests.add_test(
+        "objects load alongside forward references", [] {
+        otio::ErrorStatus err;
+        otio::SerializableObject::Retainer<> so(
+            otio::SerializableObject::from_json_string(
+                R"CONTENT({
+                    "OTIO_SCHEMA": "SerializableCollection.1",
+                    "name": "root",
+                    "metadata": {},
+                    "children": [
+                        {
+                            "OTIO_SCHEMA": "SerializableCollection.1",
+                            "name": "holder",
+                            "metadata": {},
+                            "children": [
+                                {"OTIO_SCHEMA": "SerializableObjectRef.1", "id": "Clip-1"}
+                            ]
+                        },
+                        {
+                            "OTIO_SCHEMA": "Track.1",
+                            "name": "track",
+                            "metadata": {},
+                            "source_range": null,
+                            "effects": [],
+                            "markers": [],
+                            "enabled": true,
+                            "kind": "Video",
+                            "children": [
+                                {
+                                    "OTIO_SCHEMA": "Clip.2",
+                                    "OTIO_REF_ID": "Clip-1",
+                                    "name": "clip",
+                                    "metadata": {},
+                                    "source_range": null,
+                                    "effects": [],
+                                    "markers": [],
+                                    "enabled": true,
+                                    "media_references": {},
+                                    "active_media_reference_key": "DEFAULT_MEDIA"
+                                }
+                            ]
+                        }
+                    ]
+                })CONTENT",
+                &err));
+        assertFalse(otio::is_error(err));
+
+        auto root = dynamic_cast<otio::SerializableCollection*>(so.value);
+        assertTrue(root != nullptr);
+        assertEqual(root->children().size(), 2);
+
+        auto holder =
+            dynamic_cast<otio::SerializableCollection*>(root->children()[0].value);
+        auto track = dynamic_cast<otio::Track*>(root->children()[1].value);
+        assertTrue(holder != nullptr);
+        assertTrue(track != nullptr);
+        assertEqual(track->children().size(), 1);
+        assertEqual(track->children()[0].value->name(), std::string("clip"));
+        assertTrue(holder->children()[0].value == track->children()[0].value);
+
+        otio::SerializableObject::Retainer<otio::Track> cloned(
+            dynamic_cast<otio::Track*>(track->clone(&err)));
+        assertFalse(otio::is_error(err));
+        assertEqual(cloned.value->children().size(), 1);
+        assertTrue(cloned.value->is_equivalent_to(*track));
+    });
+
+    tests.add_test(
+        "a child shared by two compositions is reported", [] {
+        otio::ErrorStatus err;
+        otio::SerializableObject::Retainer<> so(
+            otio::SerializableObject::from_json_string(
+                R"CONTENT({
+                    "OTIO_SCHEMA": "Stack.1",
+                    "name": "stack",
+                    "children": [
+                        {
+                            "OTIO_SCHEMA": "Track.1",
+                            "name": "first",
+                            "kind": "Video",
+                            "children": [
+                                {
+                                    "OTIO_SCHEMA": "Clip.2",
+                                    "OTIO_REF_ID": "Clip-1",
+                                    "name": "clip",
+                                    "media_references": {},
+                                    "active_media_reference_key": "DEFAULT_MEDIA"
+                                }
+                            ]
+                        },
+                        {
+                            "OTIO_SCHEMA": "Track.1",
+                            "name": "second",
+                            "kind": "Video",
+                            "children": [
+                                {"OTIO_SCHEMA": "SerializableObjectRef.1", "id": "Clip-1"}
+                            ]
+                        }
+                    ]
+                })CONTENT",
+                &err));
+        assertTrue(so.value == nullptr);
+        assertEqual(err.outcome, otio::ErrorStatus::CHILD_ALREADY_PARENTED);
+    });
+
+    tests.add_test(
+        "files are read in place", [] {
+        const std::string file_name =
+            (std::filesystem::temp_directory_path()
+             / "test_serialization_in_place.otio")
+                .string();
+
+        otio::SerializableObject::Retainer<otio::Clip> cl =
+            new otio::Clip("quote \" backslash \\ tab \t");
+        cl->metadata()["escaped \"key\""] = std::string("line\nbreak");
+
+        otio::ErrorStatus err;
+        assertTrue(cl->to_json_file(file_name, &err));
+        otio::SerializableObject::Retainer<> so(
+            otio::SerializableObject::from_json_file(file_name, &err));
+        std::filesystem::remove(file_name);
+        assertFalse(otio::is_error(err));
+
+        auto read = dynamic_cast<otio::Clip*>(so.value);
+        assertTrue(read != nullptr);
+        assertEqual(read->name(), cl->name());
+        assertTrue(read->is_equivalent_to(*cl));
+
+        so = otio::SerializableObject::from_json_file(file_name, &err);
+        assertTrue(so.value == nullptr);
+        assertEqual(err.outcome, otio::ErrorStatus::FILE_OPEN_FAILED);
+    });
+
+    tests.add_test(
+        "empty files are reported", [] {
+        const std::string file_name =
+            (std::filesystem::temp_directory_path()
+             / "test_serialization_empty.otio")
+                .string();
+        std::ofstream(file_name).close();
+
+        otio::ErrorStatus err;
+        otio::SerializableObject::Retainer<> so(
+            otio::SerializableObject::from_json_file(file_name, &err));
+        std::filesystem::remove(file_name);
+        assertTrue(so.value == nullptr);
+        assertTrue(otio::is_error(err));
+    });
+
+    tests.add_test(
+        "parse errors report their line", [] {
+        otio::ErrorStatus err;
+        std::any          value;
+        bool              ok = otio::deserialize_json_from_string(
+            "{\n"
+            "    \"OTIO_SCHEMA\": \"SerializableObjectWithMetadata.1\",\n"
+            "    \"name\": [,\n"
+            "}",
+            &value,
+            &err);
+        assertFalse(ok);
+        assertEqual(err.outcome, otio::ErrorStatus::JSON_PARSE_ERROR);
+        assertTrue(err.details.find("line 3") != std::string::npos);
+
+        ok = otio::deserialize_json_from_string(
+            "{\n"
+            "    \"OTIO_SCHEMA\": \"SerializableObjectWithMetadata.1\",\n"
+            "    \"metadata\": {\"a\": {\"OTIO_SCHEMA\": \"SerializableObjectRef.1\",\n"
+            "                          \"id\": \"missing\"}},\n"
+            "    \"name\": \"\"\n"
+            "}",
+            &value,
+            &err);
+        assertFalse(ok);
+        assertEqual(err.outcome, otio::ErrorStatus::UNRESOLVED_OBJECT_REFERENCE);
+        assertTrue(err.details.find("near line 6") != std::string::npos);
+    });
+
+    tests.add_test(
+        "files without indent are compact", [] {
+        const std::string file_name =
+            (std::filesystem::temp_directory_path()
+             / "test_serialization_compact.otio")
+                .string();
+
+        otio::SerializableObject::Retainer<otio::Clip> cl =
+            new otio::Clip("compact");
+        cl->metadata()["key"] = std::string("value");
+
+        otio::ErrorStatus err;
+        assertTrue(cl->to_json_file(file_name, &err, {}, 0));
+
+        std::ifstream     file(file_name);
+        std::stringstream contents;
+        contents << file.rdbuf();
+        file.close();
+        std::filesystem::remove(file_name);
+
+        assertEqual(contents.str(), cl->to_json_string(&err, {}, 0));
+        assertTrue(contents.str().find('\n') == std::string::npos);
+    });
+
+    tests.add_test(
+        "instanced objects are written again but cycles fail", [] {
+        otio::SerializableObject::Retainer<otio::SerializableCollection> sc =
+            new otio::SerializableCollection("collection");
+        otio::SerializableObject::Retainer<otio::Clip> cl =
+            new otio::Clip("clip");
+        sc->insert_child(0, cl);
+        sc->insert_child(1, cl);
+
+        otio::ErrorStatus err;
+        const std::string clip_json = cl->to_json_string(&err, {}, 0);
+        const std::string json      = sc->to_json_string(&err, {}, 0);
+        assertFalse(otio::is_error(err));
+        assertTrue(json.find(clip_json) != json.rfind(clip_json));
+
+        sc->insert_child(2, sc);
+        sc->to_json_string(&err, {}, 0);
+        assertEqual(err.outcome, otio::ErrorStatus::OBJECT_CYCLE);
+        sc->remove_child(2);
+    });
+
+    tests.add_test(
+        "clones copy every object once", [] {
+        otio::SerializableObject::Retainer<otio::Timeline> tl =
+            new otio::Timeline("timeline");
+        otio::SerializableObject::Retainer<otio::Track> tr =
+            new otio::Track("track");
+        otio::SerializableObject::Retainer<otio::Clip> cl =
+            new otio::Clip("clip");
+        cl->set_source_range(otime::TimeRange(
+            otime::RationalTime(0, 24),
+            otime::RationalTime(10, 24)));
+        cl->metadata()["nested"] = otio::AnyDictionary{
+            { "time", otime::RationalTime(5, 24) },
+            { "list", otio::AnyVector{ int64_t(1), std::string("two") } },
+        };
+        cl->metadata()["object"] = otio::SerializableObject::Retainer<>(
+            new otio::SerializableObjectWithMetadata("held"));
+        tr->append_child(cl);
+        tl->tracks()->append_child(tr);
+
+        otio::ErrorStatus err;
+        otio::SerializableObject::Retainer<otio::Timeline> cloned(
+            dynamic_cast<otio::Timeline*>(tl->clone(&err)));
+        assertFalse(otio::is_error(err));
+        assertTrue(cloned.value != nullptr);
+        assertTrue(cloned->is_equivalent_to(*tl));
+        assertEqual(
+            cloned->to_json_string(&err, {}, 0),
+            tl->to_json_string(&err, {}, 0));
+
+        auto cloned_track =
+            dynamic_cast<otio::Track*>(cloned->tracks()->children()[0].value);
+        assertTrue(cloned_track != nullptr);
+        assertTrue(cloned_track != tr.value);
+        assertTrue(cloned_track->parent() == cloned->tracks());
+        auto cloned_clip =
+            dynamic_cast<otio::Clip*>(cloned_track->children()[0].value);
+        assertTrue(cloned_clip != nullptr);
+        assertTrue(cloned_clip != cl.value);
+        assertTrue(cloned_clip->parent() == cloned_track);
+        assertTrue(
+            cloned_clip->range_in_parent(&err) == cl->range_in_parent(&err));
+
+        auto held = std::any_cast<otio::SerializableObject::Retainer<>>(
+            cloned_clip->metadata()["object"]);
+        assertTrue(held.value != nullptr);
+        assertTrue(
+            held.value
+            != std::any_cast<otio::SerializableObject::Retainer<>>(
+                   cl->metadata()["object"])
+                   .value);
+
+        cl->metadata()["self"] = otio::SerializableObject::Retainer<>(cl);
+        otio::SerializableObject::Retainer<> cycle(cl->clone(&err));
+        assertTrue(cycle.value == nullptr);
+        assertEqual(err.outcome, otio::ErrorStatus::OBJECT_CYCLE);
+        cl->metadata().erase("self");
+    });
+
+    tests.add_test(
+        "clones share metadata until it is changed", [] {
+        otio::SerializableObject::Retainer<otio::Clip> cl = new otio::Clip(
+            "clip",
+            nullptr,
+            std::nullopt,
+            otio::AnyDictionary{
+                { "edl",
+                  otio::AnyDictionary{
+                      { "reel", std::string("A001") },
+                      { "events", otio::AnyVector{ int64_t(1), int64_t(2) } },
+                  } },
+            });
+
+        otio::ErrorStatus err;
+        auto clone_of = [&err](otio::Clip* clip) {
+            return otio::SerializableObject::Retainer<otio::Clip>(
+                dynamic_cast<otio::Clip*>(clip->clone(&err)));
+        };
+
+        auto first = clone_of(cl);
+        assertTrue(first->is_equivalent_to(*cl));
+        first->metadata()["changed"] = true;
+        assertFalse(cl->metadata().has_key("changed"));
+
+        auto second = clone_of(cl);
+        cl->metadata()["changed"] = true;
+        assertFalse(second->metadata().has_key("changed"));
+        assertEqual(second->metadata().size(), 1);
+
+        // a reference handed out earlier still only changes its own object
+        otio::AnyDictionary& metadata = cl->metadata();
+        auto                 third    = clone_of(cl);
+        metadata["later"]             = true;
+        assertFalse(third->metadata().has_key("later"));
+        assertTrue(cl->metadata().has_key("later"));
+
+        // however many clones are made after it was handed out
+        auto fourth = clone_of(cl);
+        auto fifth  = clone_of(cl);
+        metadata["much later"] = true;
+        assertFalse(fourth->metadata().has_key("much later"));
+        assertFalse(fifth->metadata().has_key("much later"));
+    });
+
+    tests.add_test(
+        "equivalence compares objects as they are written", [] {
+        otio::SerializableObject::Retainer<otio::Track> tr =
+            new otio::Track("track");
+        for (int i = 0; i < 3; i++)
+        {
+            otio::SerializableObject::Retainer<otio::Clip> cl =
+                new otio::Clip("clip " + std::to_string(i));
+            cl->metadata()["index"] = int64_t(i);
+            cl->metadata()["label"] = "literal";
+            tr->append_child(cl);
+        }
+
+        otio::ErrorStatus err;
+        otio::SerializableObject::Retainer<otio::Track> other(
+            dynamic_cast<otio::Track*>(tr->clone(&err)));
+        assertFalse(otio::is_error(err));
+        assertTrue(tr->is_equivalent_to(*other));
+
+        // a char const* is written as the string it points to
+        auto last = dynamic_cast<otio::Clip*>(other->children()[2].value);
+        last->metadata()["label"] = std::string("literal");
+        assertTrue(tr->is_equivalent_to(*other));
+        assertTrue(other->is_equivalent_to(*tr));
+
+        last->metadata()["index"] = 2.0;
+        assertFalse(tr->is_equivalent_to(*other));
+        last->metadata()["index"] = int64_t(2);
+        last->set_enabled(false);
+        assertFalse(tr->is_equivalent_to(*other));
+        last->set_enabled(true);
+        assertTrue(tr->is_equivalent_to(*other));
+
+        tr->metadata()["self"] = otio::SerializableObject::Retainer<>(tr);
+        other->metadata()["self"] = otio::SerializableObject::Retainer<>(other);
+        assertFalse(tr->is_equivalent_to(*other));
+        tr->metadata().erase("self");
+        other->metadata().erase("self");
+
+        // an unknown schema is written under its original label, so it is
+        // equivalent to a known object written under the same one
+        otio::SerializableObject::Retainer<> known =
+            new otio::SerializableObject;
+        otio::SerializableObject::Retainer<> unknown =
+            new otio::UnknownSchema("SerializableObject", 1);
+        assertTrue(known->is_equivalent_to(*unknown));
+        assertTrue(unknown->is_equivalent_to(*known));
+    });
+
+    tests.add_test(
+        "content hashes follow what is serialized", [] {
+        otio::SerializableObject::Retainer<otio::Track> tr =
+            new otio::Track("track");
+        otio::SerializableObject::Retainer<otio::Clip> cl =
+            new otio::Clip("clip");
+        cl->metadata()["label"] = std::string("value");
+        tr->append_child(cl);
+
+        otio::ErrorStatus err;
+        const auto        hash = tr->content_hash(&err);
+        assertFalse(otio::is_error(err));
+        assertEqual(hash.to_string().size(), 32);
+        assertTrue(hash == tr->content_hash());
+
+        otio::SerializableObject::Retainer<> cloned(tr->clone(&err));
+        assertTrue(cloned->content_hash() == hash);
+        otio::SerializableObject::Retainer<> read(
+            otio::SerializableObject::from_json_string(
+                tr->to_json_string(&err),
+                &err));
+        assertTrue(read->content_hash() == hash);
+
+        // edits are seen whether they change the object itself or one it
+        // holds, and undoing them restores the digest
+        const auto clip_hash = cl->content_hash();
+        cl->set_name("renamed");
+        assertTrue(tr->content_hash() != hash);
+        assertTrue(cl->content_hash() != clip_hash);
+        cl->set_name("clip");
+        assertTrue(tr->content_hash() == hash);
+        cl->metadata()["label"] = std::string("other");
+        assertTrue(tr->content_hash() != hash);
+        cl->metadata()["label"] = std::string("value");
+        tr->append_child(new otio::Gap);
+        assertTrue(tr->content_hash() != hash);
+        tr->remove_child(1);
+        assertTrue(tr->content_hash() == hash);
+
+        // so are edits to objects held anywhere below, such as in metadata
+        // or as a media reference
+        otio::SerializableObject::Retainer<otio::Clip> held =
+            new otio::Clip("held");
+        tr->metadata()["held"] = otio::SerializableObject::Retainer<>(held);
+        const auto with_held = tr->content_hash();
+        held->set_name("changed");
+        assertTrue(tr->content_hash() != with_held);
+        held->set_name("held");
+        assertTrue(tr->content_hash() == with_held);
+
+        otio::SerializableObject::Retainer<otio::ExternalReference> ref =
+            new otio::ExternalReference("file.mov");
+        cl->set_media_reference(ref);
+        const auto with_ref = tr->content_hash();
+        ref->set_target_url("other.mov");
+        assertTrue(tr->content_hash() != with_ref);
+        tr->metadata().erase("held");
+
+        // a change only drops the digests above it: another tree keeps its
+        // own, as an edit it was not told about shows
+        otio::SerializableObject::Retainer<otio::Clip> other =
+            new otio::Clip("other");
+        auto& other_metadata = other->metadata();
+        const auto other_hash = other->content_hash();
+        other_metadata["unseen"] = true;
+        cl->set_name("renamed again");
+        assertTrue(other->content_hash() == other_hash);
+        other->content_changed();
+        assertTrue(other->content_hash() != other_hash);
+
+        tr->metadata()["self"] = otio::SerializableObject::Retainer<>(tr);
+        tr->content_hash(&err);
+        assertEqual(err.outcome, otio::ErrorStatus::OBJECT_CYCLE);
+        tr->metadata().erase("self");
+    });
+
+    tests.add_test(
+        "documents can intern their strings", [] {
+        otio::SerializableObject::Retainer<otio::Track> tr =
+            new otio::Track("track");
+        for (int i = 0; i < 10; i++)
+        {
+            tr->append_child(new otio::Clip(
+                "shared clip name",
+                new otio::ExternalReference(
+                    "file:///projects/show/plates/reel_A001.mov")));
+        }
+
+        otio::ErrorStatus err;
+        const std::string json         = tr->to_json_string(&err);
+        const auto        stats_before = otio::InternedString::pool_stats();
+
+        otio::ReadOptions options;
+        options.intern_strings = true;
+        otio::SerializableObject::Retainer<otio::Track> read(
+            dynamic_cast<otio::Track*>(otio::SerializableObject::from_json_string(
+                json,
+                &err,
+                options)));
+        assertFalse(otio::is_error(err));
+        assertTrue(read->is_equivalent_to(*tr));
+        assertEqual(read->to_json_string(&err), json);
+
+        // each distinct value is stored once
+        const auto stats = otio::InternedString::pool_stats();
+        assertEqual(stats.strings, stats_before.strings + 3);
+        assertEqual(stats.references, stats_before.references + 21);
+        assertTrue(stats.bytes_saved() > stats_before.bytes_saved());
+
+        auto first = dynamic_cast<otio::Clip*>(read->children()[0].value);
+        auto last  = dynamic_cast<otio::Clip*>(read->children()[9].value);
+        assertTrue(first->is_equivalent_to(*last));
+        first->set_name("renamed");
+        assertEqual(first->name(), std::string("renamed"));
+        assertEqual(last->name(), std::string("shared clip name"));
+
+        // values leave the pool with the last string referring to them
+        read = nullptr;
+        assertEqual(
+            otio::InternedString::pool_stats().strings,
+            stats_before.strings);
+
+#ifdef OTIO_FLAT_ANY_DICTIONARY
+        // as are the keys of the dictionaries read
+        otio::SerializableObject::Retainer<> with_metadata(
+            otio::SerializableObject::from_json_string(
+                R"CONTENT({
+                    "OTIO_SCHEMA": "SerializableObjectWithMetadata.1",
+                    "metadata": {
+                        "cmx_3600": {"reel": "A001"},
+                        "reel": "A001"
+                    }
+                })CONTENT",
+                &err,
+                options));
+        assertFalse(otio::is_error(err));
+        const auto key_stats = otio::InternedString::pool_stats();
+        assertEqual(key_stats.strings, stats_before.strings + 2);
+        assertEqual(key_stats.references, stats_before.references + 3);
+        with_metadata = nullptr;
+        assertEqual(
+            otio::InternedString::pool_stats().strings,
+            stats_before.strings);
+#endif
+
+        otio::InternedString a = otio::InternedString::intern("a");
+        otio::InternedString b = otio::InternedString::intern("a");
+        assertTrue(a.is_interned());
+        assertTrue(a == b);
+        assertTrue(a == otio::InternedString(std::string("a")));
+        assertTrue(a != otio::InternedString::intern("b"));
+    });
+
+    tests.add_test(
+        "dictionaries behave like std::map", [] {
+        otio::AnyDictionary d = { { "b", int64_t(2) }, { "a", int64_t(1) } };
+        auto stamp = d.get_or_create_mutation_stamp();
+        const int64_t start = stamp->stamp;
+
+        assertTrue(d.insert({ "c", int64_t(3) }).second);
+        assertFalse(d.insert({ "c", int64_t(4) }).second);
+        assertFalse(d.emplace("a", int64_t(5)).second);
+        d["e"] = std::string("five");
+        d.emplace_hint(d.end(), "d", int64_t(4));
+        assertEqual(d.size(), 5);
+
+        std::string keys;
+        for (auto const& e: d)
+        {
+            keys += e.first;
+        }
+        assertEqual(keys, std::string("abcde"));
+        assertEqual(std::any_cast<int64_t>(d.at("c")), int64_t(3));
+        assertEqual(d.lower_bound("bb")->first, std::string("c"));
+        assertEqual(d.upper_bound("c")->first, std::string("d"));
+        assertTrue(d.find("z") == d.end());
+        assertEqual(d.count("a"), 1);
+
+        assertEqual(d.erase("b"), 1);
+        assertEqual(d.erase("b"), 0);
+        d.erase(d.find("e"));
+        assertEqual(d.size(), 3);
+        assertTrue(stamp->stamp > start);
+
+        // assigning to an existing key is not a mutation of the dictionary
+        const int64_t before = stamp->stamp;
+        d["a"] = int64_t(10);
+        assertEqual(stamp->stamp, before);
+
+        // values can be written through iterators
+        for (auto&& [key, value]: d)
+        {
+            value = key;
+        }
+        d.begin()->second = std::string("first");
+        assertEqual(
+            std::any_cast<std::string>(d.at("a")),
+            std::string("first"));
+        assertEqual(std::any_cast<std::string>(d.at("d")), std::string("d"));
+        assertEqual(d.rbegin()->first, std::string("d"));
+
+        otio::AnyDictionary copy = d;
+        assertEqual(copy.size(), 3);
+        copy.clear();
+        assertTrue(copy.empty());
+        assertEqual(d.size(), 3);
+    });
+
+    tests.add_test(
+        "core objects decode as read_from() reads them", [] {
+        otio::ErrorStatus err;
+        otio::SerializableObject::Retainer<otio::Track> track(
+            dynamic_cast<otio::Track*>(otio::SerializableObject::from_json_string(
+                R"CONTENT({
+                    "OTIO_SCHEMA": "Track.1",
+                    "name": null,
+                    "kind": "Audio",
+                    "children": [
+                        {
+                            "OTIO_SCHEMA": "Gap.1",
+                            "source_range": null,
+                            "extra": 1
+                        },
+                        {
+                            "OTIO_SCHEMA": "Clip.2",
+                            "name": "clip",
+                            "metadata": {"a": 1},
+                            "source_range": {
+                                "OTIO_SCHEMA": "TimeRange.1",
+                                "start_time": {"OTIO_SCHEMA": "RationalTime.1", "rate": 24, "value": 0},
+                                "duration": {"OTIO_SCHEMA": "RationalTime.1", "rate": 24, "value": 10}
+                            },
+                            "enabled": false,
+                            "media_references": {
+                                "DEFAULT_MEDIA": {
+                                    "OTIO_SCHEMA": "ExternalReference.1",
+                                    "target_url": "a.mov",
+                                    "available_image_bounds": null
+                                }
+                            },
+                            "active_media_reference_key": "DEFAULT_MEDIA"
+                        }
+                    ]
+                })CONTENT",
+                &err)));
+        assertFalse(otio::is_error(err));
+        assertTrue(track);
+        assertEqual(track->name(), std::string());
+        assertEqual(track->kind(), std::string("Audio"));
+        assertEqual(track->children().size(), 2);
+
+        auto gap = dynamic_cast<otio::Gap*>(track->children()[0].value);
+        assertTrue(gap != nullptr);
+        assertFalse(gap->source_range().has_value());
+        assertEqual(gap->dynamic_fields().size(), 1);
+
+        auto clip = dynamic_cast<otio::Clip*>(track->children()[1].value);
+        assertTrue(clip != nullptr);
+        assertTrue(clip->parent() == track.value);
+        assertEqual(clip->name(), std::string("clip"));
+        assertEqual(clip->metadata().size(), 1);
+        assertEqual(
+            clip->source_range()->duration(),
+            otio::RationalTime(10, 24));
+        assertFalse(clip->enabled());
+        auto reference =
+            dynamic_cast<otio::ExternalReference*>(clip->media_reference());
+        assertTrue(reference != nullptr);
+        assertEqual(reference->target_url(), std::string("a.mov"));
+        assertEqual(
+            track->range_of_child_at_index(1).start_time(),
+            otio::RationalTime());
+
+        // a field of the wrong type is reported as it always was
+        otio::SerializableObject::Retainer<> bad(
+            otio::SerializableObject::from_json_string(
+                R"CONTENT({"OTIO_SCHEMA": "Gap.1", "enabled": 1})CONTENT",
+                &err));
+        assertEqual(err.outcome, otio::ErrorStatus::TYPE_MISMATCH);
+    });
+
+    tests.add_test("values are classified by kind", [] {
+        using otio::AnyKind;
+        assertTrue(
+            otio::safely_typed_any_kind(std::any()) == AnyKind::null_value);
+        assertTrue(
+            otio::safely_typed_any_kind(std::any(true)) == AnyKind::bool_value);
+        assertTrue(
+            otio::safely_typed_any_kind(std::any(int64_t(1)))
+            == AnyKind::int64_value);
+        assertTrue(
+            otio::safely_typed_any_kind(std::any(1.5)) == AnyKind::double_value);
+        assertTrue(
+            otio::safely_typed_any_kind(std::any(std::string("a")))
+            == AnyKind::string_value);
+        assertTrue(
+            otio::safely_typed_any_kind(std::any(otio::RationalTime(1, 24)))
+            == AnyKind::rational_time_value);
+        assertTrue(
+            otio::safely_typed_any_kind(std::any(otio::AnyDictionary()))
+            == AnyKind::dictionary_value);
+        assertTrue(
+            otio::safely_typed_any_kind(std::any(otio::AnyVector()))
+            == AnyKind::vector_value);
+        assertTrue(
+            otio::safely_typed_any_kind(
+                std::any(otio::SerializableObject::Retainer<>()))
+            == AnyKind::object_value);
+        assertTrue(
+            otio::safely_typed_any_kind(std::any(short(1))) == AnyKind::other);
+    });
+
     tests.run(argc, argv);
     return 0;
 }
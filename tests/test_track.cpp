@@ -4,14 +4,37 @@
 #include "utils.h"
 
 #include <opentimelineio/clip.h>
+#include <opentimelineio/externalReference.h>
+#include <opentimelineio/linearTimeWarp.h>
 #include <opentimelineio/stack.h>
 #include <opentimelineio/track.h>
+#include <opentimelineio/transition.h>
 
 #include <iostream>
 
 namespace otime = opentime::OPENTIME_VERSION;
 namespace otio  = opentimelineio::OPENTIMELINEIO_VERSION;
 
+// A composition written before child_ranges() existed, which lays its
+// children out one after the other.
+class LegacyComposition : public otio::Composition
+{
+public:
+    std::map<otio::Composable*, otio::TimeRange>
+    range_of_all_children(otio::ErrorStatus* error_status) const override
+    {
+        std::map<otio::Composable*, otio::TimeRange> result;
+        otio::RationalTime                           start(0.0, 24.0);
+        for (auto const& child: children())
+        {
+            const auto duration = child->duration(error_status);
+            result[child.value] = otio::TimeRange(start, duration);
+            start               = start + duration;
+        }
+        return result;
+    }
+};
+
 int
 main(int argc, char** argv)
 {
@@ -166,6 +189,467 @@ main(int argc, char** argv)
             std::find(items.begin(), items.end(), clip.value) != items.end());
     });
 
+    tests.add_test(
+        "test_range_of_child_after_edits", [] {
+        using namespace otio;
+
+        SerializableObject::Retainer<Stack> stack = new Stack;
+        SerializableObject::Retainer<Track> track = new Track;
+        SerializableObject::Retainer<Track> inner = new Track;
+        SerializableObject::Retainer<Clip>  clip0 = new Clip;
+        SerializableObject::Retainer<Clip>  clip1 = new Clip;
+        SerializableObject::Retainer<Clip>  clip2 = new Clip;
+        const TimeRange range(RationalTime(0.0, 24.0), RationalTime(10.0, 24.0));
+        clip0->set_source_range(range);
+        clip1->set_source_range(range);
+        clip2->set_source_range(range);
+        inner->append_child(clip0);
+        track->append_child(inner);
+        track->append_child(clip1);
+        track->append_child(clip2);
+        stack->append_child(track);
+
+        otio::ErrorStatus err;
+        assertEqual(
+            track->range_of_child_at_index(2, &err).start_time(),
+            RationalTime(20.0, 24.0));
+        assertFalse(is_error(err));
+
+        // Changing the source range of a child moves its later siblings.
+        clip1->set_source_range(
+            TimeRange(RationalTime(0.0, 24.0), RationalTime(5.0, 24.0)));
+        assertEqual(
+            track->range_of_child_at_index(2, &err).start_time(),
+            RationalTime(15.0, 24.0));
+
+        // So does a change deeper in the hierarchy.
+        clip0->set_source_range(
+            TimeRange(RationalTime(0.0, 24.0), RationalTime(20.0, 24.0)));
+        assertEqual(
+            track->range_of_child_at_index(2, &err).start_time(),
+            RationalTime(25.0, 24.0));
+        assertEqual(
+            clip2->range_in_parent(&err).start_time(),
+            RationalTime(25.0, 24.0));
+
+        // Structural edits.
+        track->remove_child(0);
+        assertEqual(
+            track->range_of_child_at_index(1, &err).start_time(),
+            RationalTime(5.0, 24.0));
+        track->insert_child(0, inner);
+        assertEqual(
+            track->range_of_child_at_index(1, &err).start_time(),
+            RationalTime(20.0, 24.0));
+
+        // A clip without a source range follows its media reference.
+        SerializableObject::Retainer<ExternalReference> media =
+            new ExternalReference("", range);
+        clip1->set_source_range(std::nullopt);
+        clip1->set_media_reference(media);
+        assertEqual(
+            track->range_of_child_at_index(2, &err).start_time(),
+            RationalTime(30.0, 24.0));
+        media->set_available_range(
+            TimeRange(RationalTime(0.0, 24.0), RationalTime(2.0, 24.0)));
+        assertEqual(
+            track->range_of_child_at_index(2, &err).start_time(),
+            RationalTime(22.0, 24.0));
+        assertFalse(is_error(err));
+    });
+
+    tests.add_test(
+        "test_index_of_child", [] {
+        using namespace otio;
+
+        SerializableObject::Retainer<Track> track = new Track;
+        SerializableObject::Retainer<Clip>  clip0 = new Clip("clip0");
+        SerializableObject::Retainer<Clip>  clip1 = new Clip("clip1");
+        SerializableObject::Retainer<Clip>  clip2 = new Clip("clip2");
+        SerializableObject::Retainer<Clip>  clip3 = new Clip("clip3");
+        track->append_child(clip0);
+        track->append_child(clip2);
+        track->insert_child(1, clip1);
+
+        otio::ErrorStatus err;
+        assertEqual(track->index_of_child(clip0, &err), 0);
+        assertEqual(track->index_of_child(clip1, &err), 1);
+        assertEqual(track->index_of_child(clip2, &err), 2);
+        assertFalse(is_error(err));
+        assertEqual(track->index_of_child(clip3, &err), -1);
+        assertEqual(err.outcome, otio::ErrorStatus::NOT_A_CHILD_OF);
+
+        err = otio::ErrorStatus();
+        track->remove_child(0);
+        assertEqual(track->index_of_child(clip1, &err), 0);
+        assertEqual(track->index_of_child(clip2, &err), 1);
+        assertFalse(track->has_child(clip0));
+        track->set_child(1, clip3);
+        assertEqual(track->index_of_child(clip3, &err), 1);
+        assertFalse(track->has_child(clip2));
+        assertTrue(track->has_child(clip3));
+        assertFalse(is_error(err));
+
+        // Deserialized compositions can be queried too.
+        SerializableObject::Retainer<Track> copy(
+            dynamic_cast<Track*>(track->clone(&err)));
+        assertFalse(is_error(err));
+        assertEqual(copy->index_of_child(copy->children()[1], &err), 1);
+        assertTrue(copy->has_child(copy->children()[0]));
+        assertFalse(is_error(err));
+    });
+
+    tests.add_test(
+        "test_child_at_time_after_edits", [] {
+        using namespace otio;
+
+        SerializableObject::Retainer<Stack> stack = new Stack;
+        SerializableObject::Retainer<Track> track = new Track;
+        SerializableObject::Retainer<Track> inner = new Track;
+        SerializableObject::Retainer<Clip>  clip0 = new Clip("clip0");
+        SerializableObject::Retainer<Clip>  clip1 = new Clip("clip1");
+        SerializableObject::Retainer<Clip>  clip2 = new Clip("clip2");
+        const TimeRange range(RationalTime(0.0, 24.0), RationalTime(10.0, 24.0));
+        clip0->set_source_range(range);
+        clip1->set_source_range(range);
+        clip2->set_source_range(range);
+        inner->append_child(clip1);
+        track->append_child(clip0);
+        track->append_child(inner);
+        track->append_child(clip2);
+        stack->append_child(track);
+
+        otio::ErrorStatus err;
+        assertEqual(
+            stack->child_at_time(RationalTime(15.0, 24.0), &err).value,
+            static_cast<Composable*>(clip1.value));
+        assertEqual(
+            track->child_at_time(RationalTime(25.0, 24.0), &err).value,
+            static_cast<Composable*>(clip2.value));
+        assertEqual(
+            track->children_in_range(
+                TimeRange(RationalTime(5.0, 24.0), RationalTime(10.0, 24.0)),
+                &err).size(),
+            size_t(2));
+
+        // Lengthening a nested clip pushes the later clips out.
+        clip1->set_source_range(
+            TimeRange(RationalTime(0.0, 24.0), RationalTime(20.0, 24.0)));
+        assertEqual(
+            track->child_at_time(RationalTime(25.0, 24.0), &err, true).value,
+            static_cast<Composable*>(inner.value));
+        assertEqual(
+            stack->child_at_time(RationalTime(25.0, 24.0), &err).value,
+            static_cast<Composable*>(clip1.value));
+        assertEqual(
+            stack->child_at_time(RationalTime(35.0, 24.0), &err).value,
+            static_cast<Composable*>(clip2.value));
+
+        // Removing a child is reflected too.
+        track->remove_child(0);
+        assertEqual(
+            track->child_at_time(RationalTime(5.0, 24.0), &err, true).value,
+            static_cast<Composable*>(inner.value));
+        assertEqual(
+            track->children_in_range(
+                TimeRange(RationalTime(20.0, 24.0), RationalTime(10.0, 24.0)),
+                &err).size(),
+            size_t(1));
+        assertFalse(is_error(err));
+    });
+
+    tests.add_test("test_child_ranges", [] {
+        using namespace otio;
+
+        SerializableObject::Retainer<Track> track = new Track;
+        SerializableObject::Retainer<Clip>  clip0 = new Clip(
+            "clip0",
+            nullptr,
+            TimeRange(RationalTime(0.0, 24.0), RationalTime(10.0, 24.0)));
+        SerializableObject::Retainer<Clip> clip1 = new Clip(
+            "clip1",
+            nullptr,
+            TimeRange(RationalTime(0.0, 24.0), RationalTime(5.0, 24.0)));
+        track->append_child(clip0);
+        track->append_child(clip1);
+
+        otio::ErrorStatus      err;
+        std::vector<TimeRange> ranges;
+        track->child_ranges(&ranges, &err);
+        assertFalse(is_error(err));
+        assertEqual(ranges.size(), size_t(2));
+        assertEqual(
+            ranges[1],
+            TimeRange(RationalTime(10.0, 24.0), RationalTime(5.0, 24.0)));
+
+        // The map form agrees with the vector form.
+        auto range_map = track->range_of_all_children(&err);
+        assertEqual(range_map[clip0.value], ranges[0]);
+        assertEqual(range_map[clip1.value], ranges[1]);
+    });
+
+    tests.add_test("test_child_ranges_from_range_of_all_children", [] {
+        using namespace otio;
+
+        SerializableObject::Retainer<Composition> legacy =
+            new LegacyComposition;
+        SerializableObject::Retainer<Clip> clip0 = new Clip(
+            "clip0",
+            nullptr,
+            TimeRange(RationalTime(0.0, 24.0), RationalTime(10.0, 24.0)));
+        SerializableObject::Retainer<Clip> clip1 = new Clip(
+            "clip1",
+            nullptr,
+            TimeRange(RationalTime(0.0, 24.0), RationalTime(5.0, 24.0)));
+        legacy->append_child(clip0);
+        legacy->append_child(clip1);
+
+        otio::ErrorStatus      err;
+        std::vector<TimeRange> ranges;
+        legacy->child_ranges(&ranges, &err);
+        assertFalse(is_error(err));
+        assertEqual(ranges.size(), size_t(2));
+        assertEqual(
+            ranges[1],
+            TimeRange(RationalTime(10.0, 24.0), RationalTime(5.0, 24.0)));
+
+        auto child = legacy->child_at_time(RationalTime(12.0, 24.0), &err);
+        assertFalse(is_error(err));
+        assertEqual(child.value, static_cast<Composable*>(clip1.value));
+
+        // a composition that provides neither form reports it
+        SerializableObject::Retainer<Composition> plain = new Composition;
+        plain->append_child(new Clip);
+        plain->child_ranges(&ranges, &err);
+        assertEqual(err.outcome, otio::ErrorStatus::NOT_IMPLEMENTED);
+        assertTrue(ranges.empty());
+
+        err = otio::ErrorStatus();
+        assertTrue(plain->range_of_all_children(&err).empty());
+        assertEqual(err.outcome, otio::ErrorStatus::NOT_IMPLEMENTED);
+    });
+
+    tests.add_test("test_modification_stamp", [] {
+        using namespace otio;
+
+        SerializableObject::Retainer<Stack> stack = new Stack;
+        SerializableObject::Retainer<Track> track = new Track;
+        SerializableObject::Retainer<Clip>  clip  = new Clip("clip");
+        SerializableObject::Retainer<Transition> transition = new Transition;
+        track->append_child(clip);
+        track->append_child(transition);
+        stack->append_child(track);
+
+        // Changing a clip bumps the clip and all of its ancestors.
+        auto clip_stamp  = clip->modification_stamp();
+        auto track_stamp = track->modification_stamp();
+        auto stack_stamp = stack->modification_stamp();
+        clip->set_source_range(
+            TimeRange(RationalTime(0.0, 24.0), RationalTime(10.0, 24.0)));
+        assertTrue(clip->modification_stamp() > clip_stamp);
+        assertTrue(track->modification_stamp() > track_stamp);
+        assertTrue(stack->modification_stamp() > stack_stamp);
+
+        // Changing the children of a track does not bump its siblings.
+        clip_stamp  = clip->modification_stamp();
+        stack_stamp = stack->modification_stamp();
+        track->append_child(new Clip("clip2"));
+        assertEqual(clip->modification_stamp(), clip_stamp);
+        assertTrue(stack->modification_stamp() > stack_stamp);
+
+        stack_stamp = stack->modification_stamp();
+        transition->set_in_offset(RationalTime(1.0, 24.0));
+        assertTrue(stack->modification_stamp() > stack_stamp);
+
+        stack_stamp = stack->modification_stamp();
+        clip->mark_modified();
+        assertTrue(stack->modification_stamp() > stack_stamp);
+
+        // Effects report their changes to the items holding them.
+        SerializableObject::Retainer<LinearTimeWarp> warp = new LinearTimeWarp;
+        clip_stamp  = clip->modification_stamp();
+        stack_stamp = stack->modification_stamp();
+        clip->effects().push_back(warp.value);
+        assertTrue(clip->modification_stamp() > clip_stamp);
+        assertTrue(stack->modification_stamp() > stack_stamp);
+
+        // The appended effect is held from the next call to effects().
+        assertEqual(clip->effects().size(), size_t(1));
+        clip_stamp  = clip->modification_stamp();
+        stack_stamp = stack->modification_stamp();
+        warp->set_time_scalar(2.0);
+        assertTrue(clip->modification_stamp() > clip_stamp);
+        assertTrue(stack->modification_stamp() > stack_stamp);
+
+        stack_stamp = stack->modification_stamp();
+        warp->set_enabled(false);
+        assertTrue(stack->modification_stamp() > stack_stamp);
+
+        // So do the effects of a clone, to the clone.
+        SerializableObject::Retainer<Clip> copy =
+            dynamic_cast<Clip*>(clip->clone());
+        auto copy_stamp = copy->modification_stamp();
+        clip_stamp      = clip->modification_stamp();
+        copy->effects().front()->set_effect_name("changed");
+        assertTrue(copy->modification_stamp() > copy_stamp);
+
+        copy_stamp = copy->modification_stamp();
+        dynamic_cast<LinearTimeWarp*>(copy->effects().front().value)
+            ->set_time_scalar(3.0);
+        assertTrue(copy->modification_stamp() > copy_stamp);
+        assertEqual(clip->modification_stamp(), clip_stamp);
+
+        // Media references report their changes to every clip holding them.
+        SerializableObject::Retainer<ExternalReference> ref =
+            new ExternalReference;
+        SerializableObject::Retainer<Clip> other = new Clip("other", ref);
+        clip->set_media_reference(ref);
+        clip_stamp       = clip->modification_stamp();
+        auto other_stamp = other->modification_stamp();
+        stack_stamp      = stack->modification_stamp();
+        ref->set_available_range(
+            TimeRange(RationalTime(0.0, 24.0), RationalTime(10.0, 24.0)));
+        assertTrue(clip->modification_stamp() > clip_stamp);
+        assertTrue(other->modification_stamp() > other_stamp);
+        assertTrue(stack->modification_stamp() > stack_stamp);
+
+        stack_stamp = stack->modification_stamp();
+        ref->set_available_image_bounds(std::nullopt);
+        assertTrue(stack->modification_stamp() > stack_stamp);
+    });
+
+    tests.add_test("test_available_range_after_edits", [] {
+        using namespace otio;
+
+        SerializableObject::Retainer<Stack> stack = new Stack;
+        SerializableObject::Retainer<Track> track = new Track;
+        SerializableObject::Retainer<ExternalReference> ref =
+            new ExternalReference(
+                "",
+                TimeRange(RationalTime(0.0, 24.0), RationalTime(10.0, 24.0)));
+        SerializableObject::Retainer<Clip> clip0 = new Clip("clip0", ref);
+        SerializableObject::Retainer<Clip> clip1 = new Clip(
+            "clip1",
+            nullptr,
+            TimeRange(RationalTime(0.0, 24.0), RationalTime(5.0, 24.0)));
+        track->append_child(clip0);
+        track->append_child(clip1);
+        stack->append_child(track);
+
+        otio::ErrorStatus err;
+        assertEqual(stack->duration(&err), RationalTime(15.0, 24.0));
+        assertEqual(stack->duration(&err), RationalTime(15.0, 24.0));
+
+        clip1->set_source_range(
+            TimeRange(RationalTime(0.0, 24.0), RationalTime(20.0, 24.0)));
+        assertEqual(stack->duration(&err), RationalTime(30.0, 24.0));
+
+        ref->set_available_range(
+            TimeRange(RationalTime(0.0, 24.0), RationalTime(4.0, 24.0)));
+        assertEqual(stack->duration(&err), RationalTime(24.0, 24.0));
+
+        track->remove_child(1);
+        assertEqual(stack->duration(&err), RationalTime(4.0, 24.0));
+        assertFalse(is_error(err));
+    });
+
+    tests.add_test("test_transformed_time_after_edits", [] {
+        using namespace otio;
+
+        SerializableObject::Retainer<Stack> stack = new Stack;
+        SerializableObject::Retainer<Track> track = new Track(
+            "track",
+            TimeRange(RationalTime(10.0, 24.0), RationalTime(100.0, 24.0)));
+        SerializableObject::Retainer<Clip> clip0 = new Clip(
+            "clip0",
+            nullptr,
+            TimeRange(RationalTime(100.0, 24.0), RationalTime(50.0, 24.0)));
+        SerializableObject::Retainer<Clip> clip1 = new Clip(
+            "clip1",
+            nullptr,
+            TimeRange(RationalTime(200.0, 24.0), RationalTime(50.0, 24.0)));
+        track->append_child(clip0);
+        track->append_child(clip1);
+        stack->append_child(track);
+
+        otio::ErrorStatus err;
+        assertEqual(
+            clip1->transformed_time(RationalTime(200.0, 24.0), stack, &err),
+            RationalTime(40.0, 24.0));
+        assertEqual(
+            stack->transformed_time(RationalTime(40.0, 24.0), clip1, &err),
+            RationalTime(200.0, 24.0));
+        assertEqual(
+            clip1->transformed_time(RationalTime(200.0, 24.0), track, &err),
+            RationalTime(50.0, 24.0));
+        assertEqual(
+            clip0->transformed_time(RationalTime(100.0, 24.0), clip1, &err),
+            RationalTime(150.0, 24.0));
+        assertEqual(
+            clip0->transformed_time(RationalTime(100.0, 24.0), clip0, &err),
+            RationalTime(100.0, 24.0));
+
+        // Edits anywhere in the tree are picked up.
+        clip0->set_source_range(
+            TimeRange(RationalTime(100.0, 24.0), RationalTime(20.0, 24.0)));
+        assertEqual(
+            clip1->transformed_time(RationalTime(200.0, 24.0), stack, &err),
+            RationalTime(10.0, 24.0));
+        track->set_source_range(
+            TimeRange(RationalTime(0.0, 24.0), RationalTime(100.0, 24.0)));
+        assertEqual(
+            clip1->transformed_time(RationalTime(200.0, 24.0), stack, &err),
+            RationalTime(20.0, 24.0));
+        track->remove_child(0);
+        assertEqual(
+            clip1->transformed_time(RationalTime(200.0, 24.0), stack, &err),
+            RationalTime(0.0, 24.0));
+        assertFalse(is_error(err));
+    });
+
+    tests.add_test("test_for_each_child", [] {
+        using namespace otio;
+
+        SerializableObject::Retainer<Stack> stack = new Stack;
+        SerializableObject::Retainer<Track> track = new Track;
+        SerializableObject::Retainer<Clip>  clip0 = new Clip(
+            "clip0",
+            nullptr,
+            TimeRange(RationalTime(0.0, 24.0), RationalTime(10.0, 24.0)));
+        SerializableObject::Retainer<Clip> clip1 = new Clip(
+            "clip1",
+            nullptr,
+            TimeRange(RationalTime(0.0, 24.0), RationalTime(10.0, 24.0)));
+        track->append_child(clip0);
+        track->append_child(clip1);
+        stack->append_child(track);
+
+        otio::ErrorStatus  err;
+        std::vector<Clip*> visited;
+        stack->for_each_child<Clip>(
+            [&visited](Clip* clip) { visited.push_back(clip); },
+            &err);
+        assertEqual(visited.size(), size_t(2));
+        assertEqual(visited[0], clip0.value);
+        assertEqual(visited[1], clip1.value);
+
+        visited.clear();
+        const TimeRange search_range(
+            RationalTime(12.0, 24.0),
+            RationalTime(2.0, 24.0));
+        stack->for_each_child<Clip>(
+            [&visited](Clip* clip) { visited.push_back(clip); },
+            &err,
+            search_range);
+        assertEqual(visited.size(), size_t(1));
+        assertEqual(visited[0], clip1.value);
+
+        auto clips = stack->find_clips(&err, search_range);
+        assertEqual(clips.size(), size_t(1));
+        assertEqual(clips[0].value, clip1.value);
+        assertFalse(is_error(err));
+    });
+
     tests.run(argc, argv);
     return 0;
 }